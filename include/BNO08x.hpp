@@ -5,10 +5,14 @@
 
 #pragma once
 
+// standard library includes
+#include <new>
+#include <type_traits>
 // etl includes
 #include <etl/vector.h>
 #include <etl/variant.h>
 #include <etl/map.h>
+#include <etl/span.h>
 
 // esp-idf includes
 #include <driver/gpio.h>
@@ -18,11 +22,14 @@
 #include <freertos/task.h>
 #include <freertos/event_groups.h>
 #include <freertos/queue.h>
+#include <esp_rom_sys.h>
 // in-house includes
 #include "BNO08xGlobalTypes.hpp"
 #include "BNO08xPrivateTypes.hpp"
 #include "BNO08xSH2HAL.hpp"
 #include "BNO08xReports.hpp"
+#include "BNO08xFrame.hpp"
+#include "BNO08xAllocator.hpp"
 
 /**
  * @class BNO08x
@@ -32,17 +39,21 @@
 class BNO08x
 {
     public:
-        BNO08x(bno08x_config_t imu_config = bno08x_config_t());
+        BNO08x(bno08x_config_t imu_config = bno08x_config_t(), BNO08xAllocator* allocator = nullptr);
         ~BNO08x();
 
         bool initialize();
         bool hard_reset();
         bool soft_reset();
         bool disable_all_reports();
+        bool configure_reports(etl::span<const bno08x_rpt_cfg_t> rpt_cfgs);
+        bool configure_reports(std::initializer_list<bno08x_rpt_cfg_t> rpt_cfgs);
         BNO08xResetReason get_reset_reason();
 
         bool on();
         bool sleep();
+        bool suspend();
+        bool resume();
 
         // bool calibration_turntable_start(uint32_t period_us);
         // bool calibration_turntable_end(sh2_CalStatus_t& status);
@@ -65,8 +76,66 @@ class BNO08x
         sh2_ProductIds_t get_product_IDs();
 
         bool data_available();
-        bool register_cb(std::function<void(void)> cb_fxn);
-        bool register_cb(std::function<void(uint8_t report_ID)> cb_fxn);
+        EventBits_t wait_for(EventBits_t rpt_mask, BNO08xWaitMode mode = BNO08xWaitMode::ANY,
+                uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+        size_t get_reset_log(etl::span<bno08x_reset_log_entry_t> entries);
+        uint32_t get_reset_count();
+        void clear_reset_log();
+        bno08x_drop_stats_t get_drop_stats();
+        void clear_drop_stats();
+        bno08x_hint_recovery_stats_t get_hint_recovery_stats();
+        void clear_hint_recovery_stats();
+        void set_hint_mode(BNO08xHintMode mode);
+        BNO08xHintMode get_hint_mode();
+        BNO08xSubscriber* create_subscriber();
+        bool destroy_subscriber(BNO08xSubscriber* subscriber);
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(void)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(uint8_t report_ID)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool unregister_cb(bno08x_cb_handle_t handle);
+        size_t get_cb_count();
+        bool get_cb_stats(bno08x_cb_handle_t handle, bno08x_cb_stats_t& stats);
+        bool clear_cb_stats(bno08x_cb_handle_t handle);
+        bool set_cb_budget(
+                bno08x_cb_handle_t handle, uint32_t budget_us, BNO08xCbBudgetAction action = BNO08xCbBudgetAction::FLAG);
+        bool set_cb_decimation(
+                bno08x_cb_handle_t handle, uint32_t decimation, BNO08xDecimationMode mode = BNO08xDecimationMode::LATEST);
+        bool set_cb_rate(
+                bno08x_cb_handle_t handle, float rate_hz, BNO08xDecimationMode mode = BNO08xDecimationMode::LATEST);
+
+        /**
+         * @brief Allocates a buffer from the driver's allocator, released when the driver is destroyed.
+         *
+         * Intended for optional driver buffers such as report history, ex.
+         * imu.rpt.accelerometer.enable_history(imu.allocate<bno08x_history_entry_t<bno08x_accel_t>>(256));
+         *
+         * @param count Amount of elements in the buffer.
+         * @param region Memory region the buffer should be placed in.
+         *
+         * @return The default constructed buffer, empty if out of memory or BNO08xPrivateTypes::USR_ALLOC_MAX buffers
+         * have already been allocated.
+         */
+        template <typename T>
+        etl::span<T> allocate(size_t count, BNO08xMemRegion region = BNO08xMemRegion::BULK)
+        {
+            static_assert(std::is_trivially_destructible<T>::value, "Buffers are released without being destroyed.");
+
+            T* buf = nullptr;
+
+            if (count == 0U)
+                return etl::span<T>();
+
+            lock_user_data();
+            buf = static_cast<T*>(mem.allocate(count * sizeof(T), alignof(T), region));
+            unlock_user_data();
+
+            if (buf == nullptr)
+                return etl::span<T>();
+
+            for (size_t i = 0; i < count; i++)
+                new (&buf[i]) T();
+
+            return etl::span<T>(buf, count);
+        }
 
         void print_product_ids();
         void print_system_orientation();
@@ -136,7 +205,13 @@ class BNO08x
                 CONFIG_ESP32_BNO08X_DATA_PROC_TASK_SZ; ///< Size of data_proc_task() stack in bytes
         TaskHandle_t data_proc_task_hdl;               ///<data_proc_task() task handle
         static void data_proc_task_trampoline(void* arg);
-        void data_proc_task();
+        void data_proc_task(BNO08xLane lane = BNO08xLane::HIGH);
+
+        // low lane data processing task
+        static const constexpr configSTACK_DEPTH_TYPE DATA_PROC_LOW_TASK_SZ =
+                CONFIG_ESP32_BNO08X_DATA_PROC_LOW_TASK_SZ; ///< Size of data_proc_low_task() stack in bytes
+        TaskHandle_t data_proc_low_task_hdl;               ///<data_proc_low_task() task handle
+        static void data_proc_low_task_trampoline(void* arg);
 
         // sh2 service task
         static const constexpr configSTACK_DEPTH_TYPE SH2_HAL_SERVICE_TASK_SZ =
@@ -147,10 +222,13 @@ class BNO08x
 
         // callback task
         static const constexpr configSTACK_DEPTH_TYPE CB_TASK_SZ =
-                CONFIG_ESP32_BNO08X_CB_TASK_SZ; ///< Size of sh2_HAL_service_task() stack in bytes
-        TaskHandle_t cb_task_hdl;               ///<sh2_HAL_service_task() task handle
+                CONFIG_ESP32_BNO08X_CB_TASK_SZ; ///< Size of each cb_task() worker stack in bytes
+        static const constexpr uint8_t CB_WORKER_COUNT =
+                CONFIG_ESP32_BNO08X_CB_WORKER_COUNT; ///< Amount of cb_task() workers
+        TaskHandle_t cb_task_hdl[CB_WORKER_COUNT];   ///<cb_task() task handle of each worker
         static void cb_task_trampoline(void* arg);
-        void cb_task();
+        void cb_task(BNO08xPrivateTypes::bno08x_cb_worker_t& worker);
+        static BaseType_t cb_task_affinity(uint8_t worker_idx);
 
         static const constexpr BaseType_t CB_TASK_AFFINITY = 
                 CONFIG_ESP32_BNO08X_CB_TASK_AFFINITY < 0 ? tskNO_AFFINITY : CONFIG_ESP32_BNO08X_CB_TASK_AFFINITY ;  /// tskNO_AFFINITY if not pinned to a core, 0 or 1
@@ -159,6 +237,10 @@ class BNO08x
         static const constexpr BaseType_t DATA_PROC_TASK_AFFINITY = 
                 CONFIG_ESP32_BNO08X_DATA_PROC_TASK_AFFINITY < 0 ? tskNO_AFFINITY : CONFIG_ESP32_BNO08X_DATA_PROC_TASK_AFFINITY; /// tskNO_AFFINITY if not pinned to a core, 0 or 1
         static const constexpr UBaseType_t DATA_PROC_TASK_PRIORITY = CONFIG_ESP32_BNO08X_DATA_PROC_TASK_PRIORITY; /// 6 per default, Priority of the data processing task, 0-25, 0 is lowest priority, 25 is highest priority
+
+        static const constexpr BaseType_t DATA_PROC_LOW_TASK_AFFINITY = 
+                CONFIG_ESP32_BNO08X_DATA_PROC_LOW_TASK_AFFINITY < 0 ? tskNO_AFFINITY : CONFIG_ESP32_BNO08X_DATA_PROC_LOW_TASK_AFFINITY; /// tskNO_AFFINITY if not pinned to a core, 0 or 1
+        static const constexpr UBaseType_t DATA_PROC_LOW_TASK_PRIORITY = CONFIG_ESP32_BNO08X_DATA_PROC_LOW_TASK_PRIORITY; /// 4 per default, Priority of the low lane data processing task, 0-25, 0 is lowest priority, 25 is highest priority
         
         static const constexpr BaseType_t SH2_HAL_SERVICE_TASK_AFFINITY = 
                 CONFIG_ESP32_BNO08X_SH2_HAL_SERVICE_TASK_AFFINITY < 0 ? tskNO_AFFINITY : CONFIG_ESP32_BNO08X_SH2_HAL_SERVICE_TASK_AFFINITY; /// tskNO_AFFINITY if not pinned to a core, 0 or 1
@@ -167,13 +249,40 @@ class BNO08x
 
         SemaphoreHandle_t sem_kill_tasks; ///<Counting Semaphore to count amount of killed tasks.
 
+        BNO08xPrivateTypes::bno08x_mem_ctx_t mem; ///< Storage obtained from the user's allocator, constructed before any member using it.
+
+        // clang-format off
+        #ifndef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        BNO08xPrivateTypes::bno08x_task_mem_t data_proc_task_mem;                  ///< data_proc_task() stack and TCB storage.
+        BNO08xPrivateTypes::bno08x_task_mem_t data_proc_low_task_mem;              ///< data_proc_low_task() stack and TCB storage.
+        BNO08xPrivateTypes::bno08x_task_mem_t sh2_HAL_service_task_mem;            ///< sh2_HAL_service_task() stack and TCB storage.
+        BNO08xPrivateTypes::bno08x_task_mem_t cb_task_mem[CB_WORKER_COUNT];        ///< cb_task() stack and TCB storage of each worker.
+        #endif
+        // clang-format on
+
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        StackType_t data_proc_task_stack[DATA_PROC_TASK_SZ];             ///< data_proc_task() stack storage.
+        StaticTask_t data_proc_task_buffer;                              ///< data_proc_task() TCB storage.
+        StackType_t data_proc_low_task_stack[DATA_PROC_LOW_TASK_SZ];     ///< data_proc_low_task() stack storage.
+        StaticTask_t data_proc_low_task_buffer;                          ///< data_proc_low_task() TCB storage.
+        StackType_t sh2_HAL_service_task_stack[SH2_HAL_SERVICE_TASK_SZ]; ///< sh2_HAL_service_task() stack storage.
+        StaticTask_t sh2_HAL_service_task_buffer;                        ///< sh2_HAL_service_task() TCB storage.
+        StackType_t cb_task_stack[CB_WORKER_COUNT][CB_TASK_SZ];          ///< cb_task() stack storage of each worker.
+        StaticTask_t cb_task_buffer[CB_WORKER_COUNT];                    ///< cb_task() TCB storage of each worker.
+        StaticSemaphore_t sem_kill_tasks_buffer;                         ///< sem_kill_tasks storage.
+        #endif
+        // clang-format on
+
         void lock_sh2_HAL();
         void unlock_sh2_HAL();
         void lock_user_data();
         void unlock_user_data();
 
-        void handle_sensor_report(sh2_SensorValue_t* sensor_val);
-        void handle_cb(uint8_t rpt_ID, BNO08xCbGeneric* cb_entry);
+        void handle_sensor_report(sh2_SensorValue_t* sensor_val, BNO08xLane lane);
+        void handle_cb(const BNO08xPrivateTypes::bno08x_cb_evt_t& cb_evt);
+        bool cb_decimation_update(
+                bno08x_cb_handle_t handle, uint32_t decimation, uint32_t target_period_us, BNO08xDecimationMode mode);
 
         esp_err_t init_config_args();
         esp_err_t init_gpio();
@@ -192,19 +301,37 @@ class BNO08x
         esp_err_t deinit_tasks();
         esp_err_t deinit_sh2_HAL();
 
-        esp_err_t wait_for_hint();
+        esp_err_t wait_for_hint(TickType_t timeout_ticks = HOST_INT_TIMEOUT_DEFAULT_MS);
+        esp_err_t wait_for_hint_recover();
+        bool hint_due(int64_t waited_us);
+        bool poll_for_hint();
         esp_err_t wait_for_reset();
 
         void toggle_reset();
 
+        esp_err_t recover_from_reset();
         esp_err_t re_enable_reports();
+        esp_err_t restore_hub_cfg();
+        void reset_recovered(int64_t time_us);
 
         sh2_Hal_t sh2_HAL; ///< sh2 hardware abstraction layer struct for use with sh2 HAL lib.
 
+        static const constexpr UBaseType_t RX_SENSOR_EVENT_QUEUE_SZ = 10U; ///< Length of queue_rx_sensor_event.
+        static const constexpr UBaseType_t RX_SENSOR_EVENT_LOW_QUEUE_SZ = 5U; ///< Length of queue_rx_sensor_event_low.
+
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        StaticQueue_t queue_rx_sensor_event_buffer; ///< queue_rx_sensor_event storage.
+        uint8_t queue_rx_sensor_event_storage[RX_SENSOR_EVENT_QUEUE_SZ * sizeof(sh2_SensorEvent_t)]; ///< queue_rx_sensor_event item storage.
+        StaticQueue_t queue_rx_sensor_event_low_buffer; ///< queue_rx_sensor_event_low storage.
+        uint8_t queue_rx_sensor_event_low_storage[RX_SENSOR_EVENT_LOW_QUEUE_SZ * sizeof(sh2_SensorEvent_t)]; ///< queue_rx_sensor_event_low item storage.
+        #endif
+        // clang-format on
+
         QueueHandle_t
                 queue_rx_sensor_event; ///< Queue to send sensor events from sh2 HAL sensor event callback (BNO08xSH2HAL::sensor_event_cb()) to data_proc_task()
-
-        QueueHandle_t queue_cb_report_id; ///< Queue to send report ID of most recent report to cb_task()
+        QueueHandle_t
+                queue_rx_sensor_event_low; ///< Queue to send sensor events of BNO08xLane::LOW reports from BNO08xSH2HAL::sensor_event_cb() to data_proc_low_task()
 
         bno08x_config_t imu_config{};                   ///<IMU configuration settings
         spi_bus_config_t bus_config{};                  ///<SPI bus GPIO configuration settings
@@ -214,7 +341,9 @@ class BNO08x
         BNO08xPrivateTypes::bno08x_init_status_t
                 init_status; ///<Initialization status of various functionality, used by deconstructor during cleanup, set during initialization.
         BNO08xPrivateTypes::bno08x_sync_ctx_t sync_ctx; ///< Holds context used to synchronize tasks and callback execution.
+        bool kernel_objs_created; ///< True if the constructor created every queue, semaphore and event group, checked by initialize().
         sh2_ProductIds_t product_IDs; ///< Product ID info returned IMU at initialization, can be viewed with print_product_ids()
+        BNO08xPrivateTypes::bno08x_hub_cfg_t hub_cfg; ///< Hub settings set by the user which are lost on reset, restored by recover_from_reset().
 
         // clang-format off
         etl::map<uint8_t, BNO08xRpt*, TOTAL_RPT_COUNT, etl::less<uint8_t>> usr_reports = 
@@ -265,9 +394,19 @@ class BNO08x
 
         static const constexpr uint16_t RX_DATA_LENGTH = 300U; ///<length buffer containing data received over spi
 
-        static const constexpr TickType_t HOST_INT_TIMEOUT_DEFAULT_MS =
-                CONFIG_ESP32_BNO08X_HINT_TIMEOUT_MS /
-                portTICK_PERIOD_MS; ///<Max wait between HINT being asserted by BNO08x before transaction is considered failed (in miliseconds).
+        static const constexpr uint32_t HINT_POLL_BACKOFF_MAX_US =
+                CONFIG_ESP32_BNO08X_HINT_POLL_BACKOFF_MAX_US; ///< Max delay between HINT polls in BNO08xHintMode::BUSY_POLL.
+        static const constexpr int64_t HINT_POLL_IDLE_US =
+                CONFIG_ESP32_BNO08X_HINT_POLL_IDLE_US; ///< Idle HINT time after which BNO08xHintMode::BUSY_POLL falls back to the ISR.
+
+        static const constexpr TickType_t HOST_INT_TIMEOUT_DEFAULT_MS = BNO08xPrivateTypes::ms_to_ticks(
+                CONFIG_ESP32_BNO08X_HINT_TIMEOUT_MS); ///<Max wait between HINT being asserted by BNO08x before transaction is considered failed (in ticks).
+        static const constexpr TickType_t HINT_TIMEOUT_MAX_TICKS =
+                (BNO08xPrivateTypes::ms_to_ticks(CONFIG_ESP32_BNO08X_HINT_TIMEOUT_MAX_MS) > HOST_INT_TIMEOUT_DEFAULT_MS)
+                        ? BNO08xPrivateTypes::ms_to_ticks(CONFIG_ESP32_BNO08X_HINT_TIMEOUT_MAX_MS)
+                        : HOST_INT_TIMEOUT_DEFAULT_MS; ///< Cap of the doubled HINT timeout of retries, never below the first wait.
+        static const constexpr uint8_t HINT_TIMEOUT_RETRIES =
+                CONFIG_ESP32_BNO08X_HINT_TIMEOUT_RETRIES; ///< Times a timed out HINT wait is retried before escalating.
 
         static const constexpr TickType_t DATA_AVAILABLE_TIMEOUT_MS =
                 CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS /
@@ -283,4 +422,16 @@ class BNO08x
 
         friend class BNO08xSH2HAL;
         friend class BNO08xTestHelper;
-};
\ No newline at end of file
+};
+
+// clang-format off
+#ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+/// @brief Exact RAM footprint of a BNO08x driver object in bytes, all queues, semaphores, event groups and task stacks are embedded within it.
+static const constexpr size_t BNO08X_RAM_FOOTPRINT = sizeof(BNO08x);
+
+#if CONFIG_ESP32_BNO08X_RAM_BUDGET > 0
+static_assert(BNO08X_RAM_FOOTPRINT <= CONFIG_ESP32_BNO08X_RAM_BUDGET,
+        "BNO08x RAM footprint exceeds CONFIG_ESP32_BNO08X_RAM_BUDGET, reduce task stack sizes, queue sizes or CB_MAX.");
+#endif
+#endif
+// clang-format on
\ No newline at end of file
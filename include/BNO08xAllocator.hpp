@@ -0,0 +1,102 @@
+/**
+ * @file BNO08xAllocator.hpp
+ * @author Myles Parfeniuk
+ */
+
+#pragma once
+
+// standard library includes
+#include <stddef.h>
+#include <stdint.h>
+// esp-idf includes
+#include <esp_heap_caps.h>
+// in-house includes
+#include "BNO08xGlobalTypes.hpp"
+
+/**
+ * @class BNO08xAllocator
+ *
+ * @brief Interface all driver owned storage is obtained from, passed to the BNO08x constructor.
+ *
+ * Every allocation is tracked by the driver and released with deallocate() when the BNO08x object is destroyed.
+ */
+class BNO08xAllocator
+{
+    public:
+        virtual ~BNO08xAllocator() = default;
+
+        /**
+         * @brief Allocates a block of storage.
+         *
+         * @param size Size of the block in bytes.
+         * @param alignment Required alignment of the block in bytes, a power of 2.
+         * @param region Memory region the block should be placed in.
+         *
+         * @return Pointer to the block, nullptr if out of memory.
+         */
+        virtual void* allocate(size_t size, size_t alignment, BNO08xMemRegion region) = 0;
+
+        /**
+         * @brief Releases a block returned by allocate().
+         *
+         * @param ptr The block to release.
+         *
+         * @return void, nothing to return
+         */
+        virtual void deallocate(void* ptr) = 0;
+};
+
+/**
+ * @class BNO08xHeapAllocator
+ *
+ * @brief Allocates from the ESP-IDF heap with separate capabilities for each memory region, used if no allocator
+ * is passed to the BNO08x constructor.
+ *
+ * Example, keep hot state in internal SRAM and place bulk buffers in PSRAM:
+ * BNO08xHeapAllocator allocator(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_SPIRAM);
+ */
+class BNO08xHeapAllocator : public BNO08xAllocator
+{
+    public:
+        BNO08xHeapAllocator(uint32_t hot_caps = HOT_CAPS_DEFAULT, uint32_t bulk_caps = BULK_CAPS_DEFAULT);
+
+        void* allocate(size_t size, size_t alignment, BNO08xMemRegion region) override;
+        void deallocate(void* ptr) override;
+
+        static BNO08xHeapAllocator& default_allocator();
+
+        static const constexpr uint32_t HOT_CAPS_DEFAULT =
+                MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT; ///< Default capabilities of BNO08xMemRegion::HOT storage.
+        static const constexpr uint32_t BULK_CAPS_DEFAULT = MALLOC_CAP_8BIT; ///< Default capabilities of BNO08xMemRegion::BULK storage.
+
+    private:
+        uint32_t hot_caps;  ///< Heap capabilities used for BNO08xMemRegion::HOT storage.
+        uint32_t bulk_caps; ///< Heap capabilities used for BNO08xMemRegion::BULK storage.
+};
+
+/**
+ * @class BNO08xArenaAllocator
+ *
+ * @brief Bump allocator over a user provided buffer, giving the driver a deterministic layout within a single
+ * region of memory.
+ *
+ * Blocks are never individually freed, the whole arena is reclaimed with reclaim() once the BNO08x object using it
+ * has been destroyed. The memory region requested is ignored, place the buffer itself in the desired region.
+ */
+class BNO08xArenaAllocator : public BNO08xAllocator
+{
+    public:
+        BNO08xArenaAllocator(void* buffer, size_t size);
+
+        void* allocate(size_t size, size_t alignment, BNO08xMemRegion region) override;
+        void deallocate(void* ptr) override;
+
+        void reclaim();
+        size_t used() const;
+        size_t capacity() const;
+
+    private:
+        uint8_t* buffer; ///< Start of the arena.
+        size_t size;     ///< Capacity of the arena in bytes.
+        size_t offset;   ///< Offset of the first free byte within the arena.
+};
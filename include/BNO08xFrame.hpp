@@ -0,0 +1,156 @@
+/**
+ * @file BNO08xFrame.hpp
+ * @author Myles Parfeniuk
+ */
+
+#pragma once
+
+// standard library includes
+#include <tuple>
+#include <utility>
+// etl includes
+#include <etl/vector.h>
+// esp-idf includes
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+// in-house includes
+#include "BNO08xGlobalTypes.hpp"
+#include "BNO08xPrivateTypes.hpp"
+
+class BNO08xRpt;
+
+/**
+ * @class BNO08xFrameBase
+ *
+ * @brief Type independent part of BNO08xFrame, tracks which members have updated and publishes complete frames.
+ */
+class BNO08xFrameBase
+{
+    public:
+        bool wait(uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+        void disable();
+
+    protected:
+        BNO08xFrameBase();
+        virtual ~BNO08xFrameBase();
+
+        bool attach(BNO08xRpt* const* rpts, void* const* slots, size_t rpt_count, bool aligned);
+        void member_updated(EventBits_t rpt_bit, uint64_t timestamp_us);
+
+        /**
+         * @brief Copies the pending frame (written by data_proc_task()) to the ready frame, called with user data locked.
+         *
+         * @return void, nothing to return
+         */
+        virtual void publish() = 0;
+
+        /**
+         * @brief Copies the ready frame to the frame returned to the user, called with user data locked.
+         *
+         * @return void, nothing to return
+         */
+        virtual void deliver() = 0;
+
+    private:
+        BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx; ///< Context of the IMU the member reports belong to.
+        etl::vector<BNO08xRpt*, BNO08xSubscriber::RPT_SLOT_COUNT> members; ///< Reports this frame is attached to.
+        EventBits_t member_mask;       ///< Bits of all member reports.
+        EventBits_t pending_mask;      ///< Bits of member reports updated since the last published frame.
+        uint64_t pending_timestamp_us; ///< Timestamp shared by pending members when aligned.
+        bool aligned;                  ///< True if frames are only published when all members share the same timestamp.
+        uint32_t ready_seq;            ///< Amount of frames published.
+        uint32_t read_seq;             ///< Value of ready_seq when the user last received a frame.
+        SemaphoreHandle_t sem_ready;   ///< Given when a frame is published.
+
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        StaticSemaphore_t sem_ready_buffer; ///< Storage for sem_ready.
+        #endif
+        // clang-format on
+
+        static const constexpr char* TAG = "BNO08xFrame";
+
+        friend class BNO08xRpt;
+};
+
+/**
+ * @class BNO08xFrame
+ *
+ * @brief Coherent snapshot of a set of reports, delivered atomically once every member has updated.
+ *
+ * Example: BNO08xFrame<BNO08xRptGameRV, BNO08xRptCalGyro> frame(imu.rpt.rv_game, imu.rpt.cal_gyro);
+ * then frame.enable(), frame.wait() and frame.get<0>().data.
+ */
+template <typename... TRpt>
+class BNO08xFrame : public BNO08xFrameBase
+{
+    public:
+        /**
+         * @brief BNO08xFrame constructor, frames are inactive until enable() is called.
+         *
+         * @param rpts The member reports, in the same order as the template arguments.
+         */
+        BNO08xFrame(TRpt&... rpts)
+            : rpts(&rpts...)
+        {
+        }
+
+        /**
+         * @brief BNO08xFrame destructor, detaches from member reports before the frame storage is released.
+         */
+        ~BNO08xFrame()
+        {
+            disable();
+        }
+
+        /**
+         * @brief Attaches the frame to its member reports such that it begins collecting samples.
+         *
+         * @param aligned If true, frames are only delivered when all members share the same hub timestamp.
+         *
+         * @return True if frame was enabled, false if a member report is already part of another frame.
+         */
+        bool enable(bool aligned = false)
+        {
+            return enable(aligned, std::index_sequence_for<TRpt...>{});
+        }
+
+        /**
+         * @brief Returns a member's sample and timestamp from the frame most recently received with wait().
+         *
+         * @return Timestamped sample of the I'th member report.
+         */
+        template <size_t I>
+        const auto& get() const
+        {
+            return std::get<I>(samples);
+        }
+
+    private:
+        using samples_t = std::tuple<bno08x_history_entry_t<typename TRpt::sample_t>...>;
+
+        template <size_t... I>
+        bool enable(bool aligned, std::index_sequence<I...>)
+        {
+            BNO08xRpt* const rpt_ptrs[] = {std::get<I>(rpts)...};
+            void* const slots[] = {&std::get<I>(pending)...};
+
+            return attach(rpt_ptrs, slots, sizeof...(TRpt), aligned);
+        }
+
+        void publish() override
+        {
+            ready = pending;
+        }
+
+        void deliver() override
+        {
+            samples = ready;
+        }
+
+        std::tuple<TRpt*...> rpts; ///< Member reports.
+        samples_t pending;         ///< Samples collected for the next frame, written by data_proc_task().
+        samples_t ready;           ///< Most recent complete frame.
+        samples_t samples;         ///< Frame returned to the user by get().
+};
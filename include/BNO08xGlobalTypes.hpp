@@ -25,6 +25,10 @@
 #include <stdint.h>
 #include <cstring>
 
+// etl includes
+#include <etl/largest.h>
+#include <etl/utility.h>
+
 // esp-idf includes
 #include <driver/gpio.h>
 #include <driver/spi_common.h>
@@ -43,6 +47,7 @@ typedef struct bno08x_config_t
         gpio_num_t io_cs;                 /// Chip select pin (connects to BNO08x CS pin)
         gpio_num_t io_int;                /// Host interrupt pin (connects to BNO08x INT pin)
         gpio_num_t io_rst;                /// Reset pin (connects to BNO08x RST pin)
+        gpio_num_t io_wake; /// Optional wake pin (connects to BNO08x PS0/WAKE pin), GPIO_NUM_NC if PS0 is tied high
         uint32_t sclk_speed;              ///<Desired SPI SCLK speed in Hz (max 3MHz)
         bool install_isr_service; ///<Indicates whether the ISR service for the HINT should be installed at IMU initialization, (if gpio_install_isr_service() is called before initialize() set this to false)
 
@@ -57,6 +62,7 @@ typedef struct bno08x_config_t
             , io_cs(static_cast<gpio_num_t>(CONFIG_ESP32_BNO08X_GPIO_CS))         // default: 33
             , io_int(static_cast<gpio_num_t>(CONFIG_ESP32_BNO08X_GPIO_HINT))      // default: 26
             , io_rst(static_cast<gpio_num_t>(CONFIG_ESP32_BNO08X_GPIO_RST))       // default: 32
+            , io_wake(static_cast<gpio_num_t>(CONFIG_ESP32_BNO08X_GPIO_WAKE))     // default: -1 (unused)
             , sclk_speed(static_cast<uint32_t>(CONFIG_ESP32_BNO08X_SCL_SPEED_HZ)) // default: 2MHz
             , install_isr_service(install_isr_service)                            // default: true
 
@@ -65,7 +71,8 @@ typedef struct bno08x_config_t
 
         /// @brief Overloaded IMU configuration settings constructor for custom pin settings
         bno08x_config_t(spi_host_device_t spi_peripheral, gpio_num_t io_mosi, gpio_num_t io_miso, gpio_num_t io_sclk,
-                gpio_num_t io_cs, gpio_num_t io_int, gpio_num_t io_rst, uint32_t sclk_speed, bool install_isr_service = true)
+                gpio_num_t io_cs, gpio_num_t io_int, gpio_num_t io_rst, uint32_t sclk_speed, bool install_isr_service = true,
+                gpio_num_t io_wake = GPIO_NUM_NC)
             : spi_peripheral(spi_peripheral)
             , io_mosi(io_mosi)
             , io_miso(io_miso)
@@ -73,6 +80,7 @@ typedef struct bno08x_config_t
             , io_cs(io_cs)
             , io_int(io_int)
             , io_rst(io_rst)
+            , io_wake(io_wake)
             , sclk_speed(sclk_speed)
             , install_isr_service(install_isr_service)
         {
@@ -468,6 +476,194 @@ const constexpr char* BNO08xFrsID_to_str(BNO08xFrsID id)
     }
 }
 
+/// @brief Action taken by a report when the callback queue is full (see BNO08xRpt::set_overload_policy()).
+enum class BNO08xOverloadPolicy : uint8_t
+{
+    DROP_NEWEST, ///< Discard the new callback event (default).
+    DROP_OLDEST, ///< Discard the oldest pending callback event to make room for the new one.
+    BLOCK ///< Block data processing until space is available or CONFIG_ESP32_BNO08X_CB_QUEUE_BLOCK_TIMEOUT_MS elapses, then discard the new event.
+};
+
+const constexpr char* BNO08xOverloadPolicy_to_str(BNO08xOverloadPolicy policy)
+{
+    switch (policy)
+    {
+        case BNO08xOverloadPolicy::DROP_NEWEST:
+            return "DROP_NEWEST";
+        case BNO08xOverloadPolicy::DROP_OLDEST:
+            return "DROP_OLDEST";
+        case BNO08xOverloadPolicy::BLOCK:
+            return "BLOCK";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Processing lane of a report, each lane has its own sensor event queue, data processing task and callback
+/// queue such that high rate motion reports never wait behind low rate classifier/detector traffic.
+enum class BNO08xLane : uint8_t
+{
+    HIGH, ///< Processed by data_proc_task(), callbacks executed before any LOW lane callbacks (default for motion reports).
+    LOW   ///< Processed by data_proc_low_task() (default for classifier/detector reports).
+};
+
+const constexpr char* BNO08xLane_to_str(BNO08xLane lane)
+{
+    switch (lane)
+    {
+        case BNO08xLane::HIGH:
+            return "HIGH";
+        case BNO08xLane::LOW:
+            return "LOW";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Memory region requested from a BNO08xAllocator for a piece of driver storage.
+enum class BNO08xMemRegion : uint8_t
+{
+    HOT, ///< Accessed on every sample (task stacks, kernel objects, sensor event queues), should be internal SRAM.
+    BULK ///< Large or infrequently accessed storage (callback queues, history buffers), may be external RAM.
+};
+
+const constexpr char* BNO08xMemRegion_to_str(BNO08xMemRegion region)
+{
+    switch (region)
+    {
+        case BNO08xMemRegion::HOT:
+            return "HOT";
+        case BNO08xMemRegion::BULK:
+            return "BULK";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Context a registered callback executes in.
+enum class BNO08xCbExec : uint8_t
+{
+    DEFERRED, ///< Executed by a cb_task() worker, callback may block (default).
+    INLINE    ///< Executed by data_proc_task() right after the report is updated, callback must be short and never block.
+};
+
+const constexpr char* BNO08xCbExec_to_str(BNO08xCbExec exec)
+{
+    switch (exec)
+    {
+        case BNO08xCbExec::DEFERRED:
+            return "DEFERRED";
+        case BNO08xCbExec::INLINE:
+            return "INLINE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Handle to a registered callback, returned from register_cb() and passed to BNO08x::unregister_cb(),
+/// get_cb_stats(), set_cb_budget(), etc.
+typedef struct bno08x_cb_handle_t
+{
+        uint16_t idx; ///< Index of the callback's slot, reused once the callback is unregistered.
+        uint16_t gen; ///< Generation of the callback's slot, stale handles of reused slots no longer match, 0 if invalid.
+
+        bno08x_cb_handle_t()
+            : idx(0U)
+            , gen(0U)
+        {
+        }
+
+        /**
+         * @brief Checks if the handle refers to a callback, i.e. registration was success.
+         *
+         * @return True if registration was success.
+         */
+        bool valid() const
+        {
+            return (gen != 0U);
+        }
+} bno08x_cb_handle_t;
+
+/// @brief Action taken when a callback exceeds its execution budget (see BNO08x::set_cb_budget()).
+enum class BNO08xCbBudgetAction : uint8_t
+{
+    FLAG, ///< Overrun is only counted in bno08x_cb_stats_t::overruns (default).
+    SKIP  ///< Overrun is counted and the callback's next invocation is skipped, halving its rate while it overruns.
+};
+
+const constexpr char* BNO08xCbBudgetAction_to_str(BNO08xCbBudgetAction action)
+{
+    switch (action)
+    {
+        case BNO08xCbBudgetAction::FLAG:
+            return "FLAG";
+        case BNO08xCbBudgetAction::SKIP:
+            return "SKIP";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Sample passed to a decimated callback (see BNO08x::set_cb_decimation()).
+enum class BNO08xDecimationMode : uint8_t
+{
+    LATEST, ///< The most recent sample (default).
+    AVERAGE ///< The mean of the samples since the last invocation, LATEST for samples without a meaningful mean.
+};
+
+const constexpr char* BNO08xDecimationMode_to_str(BNO08xDecimationMode mode)
+{
+    switch (mode)
+    {
+        case BNO08xDecimationMode::LATEST:
+            return "LATEST";
+        case BNO08xDecimationMode::AVERAGE:
+            return "AVERAGE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief Condition for wait_for() to return, in terms of the reports in the requested mask.
+enum class BNO08xWaitMode : uint8_t
+{
+    ANY, ///< Return as soon as any report in the mask updates.
+    ALL  ///< Return once every report in the mask has updated.
+};
+
+const constexpr char* BNO08xWaitMode_to_str(BNO08xWaitMode mode)
+{
+    switch (mode)
+    {
+        case BNO08xWaitMode::ANY:
+            return "ANY";
+        case BNO08xWaitMode::ALL:
+            return "ALL";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/// @brief How sh2_HAL_service_task() waits for the BNO08x to assert HINT, see BNO08x::set_hint_mode().
+enum class BNO08xHintMode : uint8_t
+{
+    INTERRUPT, ///< Sleep until woken by the HINT ISR (default).
+    BUSY_POLL  ///< Spin on the HINT level with adaptive back-off, falls back to INTERRUPT while HINT is idle.
+};
+
+const constexpr char* BNO08xHintMode_to_str(BNO08xHintMode mode)
+{
+    switch (mode)
+    {
+        case BNO08xHintMode::INTERRUPT:
+            return "INTERRUPT";
+        case BNO08xHintMode::BUSY_POLL:
+            return "BUSY_POLL";
+        default:
+            return "UNKNOWN";
+    }
+}
+
 /// @brief Struct to represent unit quaternion.
 typedef struct bno08x_quat_t
 {
@@ -477,6 +673,8 @@ typedef struct bno08x_quat_t
         float k;
         float rad_accuracy;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_quat_t()
             : real(0.0f)
@@ -485,6 +683,8 @@ typedef struct bno08x_quat_t
             , k(0.0f)
             , rad_accuracy(0.0f)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -531,6 +731,8 @@ typedef struct bno08x_euler_angle_t
         float z;
         float rad_accuracy;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_euler_angle_t()
             : x(0.0f)
@@ -538,6 +740,8 @@ typedef struct bno08x_euler_angle_t
             , z(0.0f)
             , rad_accuracy(0.0f)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -551,6 +755,8 @@ typedef struct bno08x_euler_angle_t
                     1.0f - 2.0f * (source.j * source.j + source.k * source.k));
             this->rad_accuracy = source.rad_accuracy;
             this->accuracy = source.accuracy;
+            this->timestamp_us = source.timestamp_us;
+            this->seq = source.seq;
             return *this;
         }
 
@@ -573,11 +779,15 @@ typedef struct bno08x_ang_vel_t
         float x;
         float y;
         float z;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_ang_vel_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -608,12 +818,16 @@ typedef struct bno08x_magf_t
         float y;
         float z;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_magf_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -643,11 +857,15 @@ typedef struct bno08x_magf_bias_t
         float x;
         float y;
         float z;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_magf_bias_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -669,12 +887,16 @@ typedef struct bno08x_gyro_t
         float y;
         float z;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_gyro_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -704,11 +926,15 @@ typedef struct bno08x_gyro_bias_t
         float x;
         float y;
         float z;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_gyro_bias_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -731,6 +957,8 @@ typedef struct bno08x_activity_classifier_t
         BNO08xAccuracy accuracy;
         uint8_t page;
         bool lastPage;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_activity_classifier_t()
             : confidence({})
@@ -738,6 +966,8 @@ typedef struct bno08x_activity_classifier_t
             , accuracy(BNO08xAccuracy::UNDEFINED)
             , page(0U)
             , lastPage(false)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -764,6 +994,8 @@ typedef struct bno08x_tap_detector_t
         int8_t z_flag;
         bool double_tap;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_tap_detector_t()
             : x_flag(0)
@@ -771,6 +1003,8 @@ typedef struct bno08x_tap_detector_t
             , z_flag(0)
             , double_tap(false)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -818,12 +1052,16 @@ typedef struct bno08x_shake_detector_t
         uint8_t y_flag;
         uint8_t z_flag;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_shake_detector_t()
             : x_flag(0U)
             , y_flag(0U)
             , z_flag(0U)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -858,12 +1096,16 @@ typedef struct bno08x_accel_t
         float y;
         float z;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_accel_t()
             : x(0.0f)
             , y(0.0f)
             , z(0.0f)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -883,11 +1125,15 @@ typedef struct bno08x_step_counter_t
         uint32_t latency;
         uint16_t steps;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_step_counter_t()
             : latency(0UL)
             , steps(0U)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -903,12 +1149,14 @@ typedef struct bno08x_step_counter_t
 /// @brief Struct to represent raw mems gyro data from raw gyro reports (units in ADC counts).
 typedef struct bno08x_raw_gyro_t
 {
-        uint32_t timestamp_us;
+        uint32_t timestamp_us;     ///< Raw sensor timestamp of the sample (see sh2_RawGyroscope_t::timestamp).
         int16_t x;
         int16_t y;
         int16_t z;
         int16_t temperature;
         BNO08xAccuracy accuracy;
+        uint64_t hub_timestamp_us; ///< 64 bit sensor timestamp in the host time base, as carried by every other sample type.
+        uint32_t seq;
 
         bno08x_raw_gyro_t()
             : timestamp_us(0UL)
@@ -917,6 +1165,8 @@ typedef struct bno08x_raw_gyro_t
             , z(0U)
             , temperature(0U)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , hub_timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -936,11 +1186,13 @@ typedef struct bno08x_raw_gyro_t
 /// ADC counts).
 typedef struct bno08x_raw_accel_t
 {
-        uint32_t timestamp_us;
+        uint32_t timestamp_us;     ///< Raw sensor timestamp of the sample (see sh2_RawAccelerometer_t::timestamp).
         int16_t x;
         int16_t y;
         int16_t z;
         BNO08xAccuracy accuracy;
+        uint64_t hub_timestamp_us; ///< 64 bit sensor timestamp in the host time base, as carried by every other sample type.
+        uint32_t seq;
 
         bno08x_raw_accel_t()
             : timestamp_us(0UL)
@@ -948,6 +1200,8 @@ typedef struct bno08x_raw_accel_t
             , y(0U)
             , z(0U)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , hub_timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -966,11 +1220,13 @@ typedef struct bno08x_raw_accel_t
 /// ADC counts).
 typedef struct bno08x_raw_magf_t
 {
-        uint32_t timestamp_us;
+        uint32_t timestamp_us;     ///< Raw sensor timestamp of the sample (see sh2_RawMagnetometer_t::timestamp).
         int16_t x;
         int16_t y;
         int16_t z;
         BNO08xAccuracy accuracy;
+        uint64_t hub_timestamp_us; ///< 64 bit sensor timestamp in the host time base, as carried by every other sample type.
+        uint32_t seq;
 
         bno08x_raw_magf_t()
             : timestamp_us(0UL)
@@ -978,6 +1234,8 @@ typedef struct bno08x_raw_magf_t
             , y(0U)
             , z(0U)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , hub_timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -997,10 +1255,14 @@ typedef struct bno08x_stability_classifier_t
 {
         BNO08xStability stability;
         BNO08xAccuracy accuracy;
+        uint64_t timestamp_us;
+        uint32_t seq;
 
         bno08x_stability_classifier_t()
             : stability(BNO08xStability::UNDEFINED)
             , accuracy(BNO08xAccuracy::UNDEFINED)
+            , timestamp_us(0ULL)
+            , seq(0UL)
         {
         }
 
@@ -1042,6 +1304,304 @@ typedef struct bno08x_sample_counts_t
         }
 } bno08x_sample_counts_t;
 
+/// @brief Counts of samples lost at each stage of the driver's processing pipeline, returned from
+/// BNO08x::get_drop_stats().
+typedef struct bno08x_drop_stats_t
+{
+        uint32_t rx_queue;     ///< Sensor events dropped because the sensor event queue of their lane was full.
+        uint32_t decode;       ///< Sensor events which failed to decode.
+        uint32_t rpt_disabled; ///< Samples discarded because their report is disabled or has no implementation.
+        uint32_t cb_queue;     ///< Callback events dropped because the callback queue to cb_task() was full.
+
+        bno08x_drop_stats_t()
+            : rx_queue(0UL)
+            , decode(0UL)
+            , rpt_disabled(0UL)
+            , cb_queue(0UL)
+        {
+        }
+} bno08x_drop_stats_t;
+
+/// @brief Counts of HINT wait timeouts and each escalation taken to recover from them, returned from
+/// BNO08x::get_hint_recovery_stats().
+typedef struct bno08x_hint_recovery_stats_t
+{
+        uint32_t timeouts;      ///< HINT waits which timed out, including retries.
+        uint32_t retries;       ///< Waits retried with a doubled timeout.
+        uint32_t recovered;     ///< Timeouts resolved by a retry, without failing the transaction.
+        uint32_t idle_timeouts; ///< Transactions failed without a reset because no HINT was due (hub idle, not stuck).
+        uint32_t soft_resets;   ///< Soft resets sent to the hub because it was stuck (requires WAKE).
+        uint32_t hard_resets;   ///< Hard resets performed because the hub was stuck (after the soft reset, if enabled).
+
+        bno08x_hint_recovery_stats_t()
+            : timeouts(0UL)
+            , retries(0UL)
+            , recovered(0UL)
+            , idle_timeouts(0UL)
+            , soft_resets(0UL)
+            , hard_resets(0UL)
+        {
+        }
+} bno08x_hint_recovery_stats_t;
+
+/// @brief Record of an IMU reset and the driver's recovery from it, returned from BNO08x::get_reset_log().
+typedef struct bno08x_reset_log_entry_t
+{
+        BNO08xResetReason reason; ///< Cause of the reset reported by the BNO08x.
+        int64_t timestamp_us;     ///< esp_timer time at which the reset was detected.
+        uint32_t recovery_us;     ///< Time from detecting the reset until report and calibration configs were restored.
+        uint32_t downtime_us; ///< Time from the last sample before the reset to the first sample after it, 0 until received.
+        uint32_t samples_lost; ///< Samples enabled reports are estimated to have missed during downtime_us.
+
+        bno08x_reset_log_entry_t()
+            : reason(BNO08xResetReason::UNDEFINED)
+            , timestamp_us(0LL)
+            , recovery_us(0UL)
+            , downtime_us(0UL)
+            , samples_lost(0UL)
+        {
+        }
+} bno08x_reset_log_entry_t;
+
+/// @brief Counts of samples lost for an individual report, returned from BNO08xRpt::get_drop_stats().
+typedef struct bno08x_rpt_drop_stats_t
+{
+        uint32_t overwritten; ///< Samples overwritten before has_new_data() was called for the previous sample.
+        uint32_t cb_queue;    ///< Callback events for this report dropped because the callback queue was full.
+        uint32_t event_queue; ///< Detector events dropped because the report's event queue was full (see pop_event()).
+
+        bno08x_rpt_drop_stats_t()
+            : overwritten(0UL)
+            , cb_queue(0UL)
+            , event_queue(0UL)
+        {
+        }
+} bno08x_rpt_drop_stats_t;
+
+/// @brief Execution statistics of a registered callback, returned from BNO08x::get_cb_stats().
+typedef struct bno08x_cb_stats_t
+{
+        static const constexpr uint8_t HISTOGRAM_BINS = 8U; ///< Amount of execution time histogram bins.
+
+        uint32_t invocations; ///< Times the callback was executed.
+        uint32_t skips;       ///< Times the callback was skipped due to BNO08xCbBudgetAction::SKIP.
+        uint32_t overruns;    ///< Times the callback exceeded its budget.
+        uint32_t min_us;      ///< Shortest execution time in microseconds (UINT32_MAX if never executed).
+        uint32_t max_us;      ///< Longest execution time in microseconds.
+        uint64_t total_us;    ///< Sum of all execution times in microseconds.
+        uint32_t histogram[HISTOGRAM_BINS]; ///< Bin N counts execution times in [4^N, 4^(N+1)) us, the last bin is open ended.
+
+        bno08x_cb_stats_t()
+            : invocations(0UL)
+            , skips(0UL)
+            , overruns(0UL)
+            , min_us(UINT32_MAX)
+            , max_us(0UL)
+            , total_us(0ULL)
+            , histogram{}
+        {
+        }
+
+        /**
+         * @brief Mean execution time of the callback.
+         *
+         * @return Mean execution time in microseconds, 0 if never executed.
+         */
+        float mean_us() const
+        {
+            return (invocations == 0UL) ? 0.0f : static_cast<float>(total_us) / static_cast<float>(invocations);
+        }
+
+        /**
+         * @brief Records one execution of the callback.
+         *
+         * @param exec_us Execution time in microseconds.
+         *
+         * @return void, nothing to return
+         */
+        void record(uint32_t exec_us)
+        {
+            uint8_t bin = 0U;
+
+            invocations++;
+            total_us += exec_us;
+            min_us = (exec_us < min_us) ? exec_us : min_us;
+            max_us = (exec_us > max_us) ? exec_us : max_us;
+
+            while ((bin < (HISTOGRAM_BINS - 1U)) && (exec_us >= (1UL << (2U * (bin + 1U)))))
+                bin++;
+
+            histogram[bin]++;
+        }
+} bno08x_cb_stats_t;
+
+/// @brief Size of the largest report sample, passed to callbacks by copy.
+static const constexpr size_t BNO08X_SAMPLE_MAX_SZ =
+        etl::largest_type<bno08x_quat_t, bno08x_activity_classifier_t, bno08x_tap_detector_t, bno08x_shake_detector_t,
+                bno08x_accel_t, bno08x_step_counter_t, bno08x_raw_gyro_t, bno08x_raw_accel_t, bno08x_raw_magf_t,
+                bno08x_stability_classifier_t, etl::pair<bno08x_quat_t, bno08x_ang_vel_t>,
+                etl::pair<bno08x_gyro_t, bno08x_gyro_bias_t>, etl::pair<bno08x_magf_t, bno08x_magf_bias_t>>::size;
+
+/**
+ * @brief Folds a sample into the running mean of the samples since a decimated callback was last invoked.
+ *
+ * Samples without a meaningful mean (classifiers, detectors, counters and raw ADC values) keep the latest sample,
+ * vector samples are averaged per axis and keep the latest accuracy.
+ *
+ * @param mean Running mean, overwritten with sample when n is 1.
+ * @param sample The sample just received.
+ * @param n Amount of samples in the mean including sample.
+ *
+ * @return void, nothing to return
+ */
+template <typename T>
+void bno08x_sample_mean(T& mean, const T& sample, uint32_t n)
+{
+    mean = sample;
+}
+
+/**
+ * @brief Folds a sample with x, y and z members into a running per axis mean, other members keep the latest value.
+ *
+ * @param mean Running mean, overwritten with sample when n is 1.
+ * @param sample The sample just received.
+ * @param n Amount of samples in the mean including sample.
+ *
+ * @return void, nothing to return
+ */
+template <typename T>
+void bno08x_sample_mean_xyz(T& mean, const T& sample, uint32_t n)
+{
+    const float x = mean.x;
+    const float y = mean.y;
+    const float z = mean.z;
+
+    mean = sample;
+
+    if (n > 1UL)
+    {
+        mean.x = x + (sample.x - x) / static_cast<float>(n);
+        mean.y = y + (sample.y - y) / static_cast<float>(n);
+        mean.z = z + (sample.z - z) / static_cast<float>(n);
+    }
+}
+
+inline void bno08x_sample_mean(bno08x_accel_t& mean, const bno08x_accel_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+inline void bno08x_sample_mean(bno08x_gyro_t& mean, const bno08x_gyro_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+inline void bno08x_sample_mean(bno08x_gyro_bias_t& mean, const bno08x_gyro_bias_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+inline void bno08x_sample_mean(bno08x_magf_t& mean, const bno08x_magf_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+inline void bno08x_sample_mean(bno08x_magf_bias_t& mean, const bno08x_magf_bias_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+inline void bno08x_sample_mean(bno08x_ang_vel_t& mean, const bno08x_ang_vel_t& sample, uint32_t n)
+{
+    bno08x_sample_mean_xyz(mean, sample, n);
+}
+
+/**
+ * @brief Folds a quaternion into a running normalized mean, valid for the small spread between decimated samples.
+ *
+ * @param mean Running mean, overwritten with sample when n is 1.
+ * @param sample The quaternion just received.
+ * @param n Amount of samples in the mean including sample.
+ *
+ * @return void, nothing to return
+ */
+inline void bno08x_sample_mean(bno08x_quat_t& mean, const bno08x_quat_t& sample, uint32_t n)
+{
+    const bno08x_quat_t prev = mean;
+    float sign = 1.0f;
+    float norm = 0.0f;
+
+    mean = sample;
+
+    if (n > 1UL)
+    {
+        // q and -q are the same rotation, average within the hemisphere of the running mean
+        if ((prev.real * sample.real + prev.i * sample.i + prev.j * sample.j + prev.k * sample.k) < 0.0f)
+            sign = -1.0f;
+
+        mean.real = prev.real + (sign * sample.real - prev.real) / static_cast<float>(n);
+        mean.i = prev.i + (sign * sample.i - prev.i) / static_cast<float>(n);
+        mean.j = prev.j + (sign * sample.j - prev.j) / static_cast<float>(n);
+        mean.k = prev.k + (sign * sample.k - prev.k) / static_cast<float>(n);
+
+        norm = sqrtf(mean.real * mean.real + mean.i * mean.i + mean.j * mean.j + mean.k * mean.k);
+
+        if (norm > 0.0f)
+        {
+            mean.real /= norm;
+            mean.i /= norm;
+            mean.j /= norm;
+            mean.k /= norm;
+        }
+    }
+}
+
+/**
+ * @brief Folds a pair sample (ex. uncalibrated gyro velocity & bias) into a running mean of each member.
+ *
+ * @param mean Running mean, overwritten with sample when n is 1.
+ * @param sample The sample just received.
+ * @param n Amount of samples in the mean including sample.
+ *
+ * @return void, nothing to return
+ */
+template <typename T1, typename T2>
+void bno08x_sample_mean(etl::pair<T1, T2>& mean, const etl::pair<T1, T2>& sample, uint32_t n)
+{
+    bno08x_sample_mean(mean.first, sample.first, n);
+    bno08x_sample_mean(mean.second, sample.second, n);
+}
+
+class BNO08xRpt;
+
+/// @brief Desired configuration of a single report, passed to BNO08x::configure_reports().
+typedef struct bno08x_rpt_cfg_t
+{
+        BNO08xRpt* rpt;                 ///< Report to configure, ex. &imu.rpt.accelerometer.
+        uint32_t period_us;             ///< Report period in microseconds, 0 to disable the report.
+        sh2_SensorConfig_t sensor_cfg;  ///< Sensor special configuration, reportInterval_us is overwritten with period_us.
+
+        bno08x_rpt_cfg_t(BNO08xRpt* rpt = nullptr, uint32_t period_us = 0UL,
+                sh2_SensorConfig_t sensor_cfg = {false, false, false, false, 0U, 0UL, 0UL, 0UL})
+            : rpt(rpt)
+            , period_us(period_us)
+            , sensor_cfg(sensor_cfg)
+        {
+        }
+} bno08x_rpt_cfg_t;
+
+/// @brief Sample stored in a report's history buffer (see enable_history() & read_since() of each report).
+template <typename T>
+struct bno08x_history_entry_t
+{
+        uint64_t timestamp_us; ///< Sensor timestamp of the sample in microseconds (see sh2_SensorValue_t::timestamp).
+        T data;                ///< The sample.
+};
+
+/// @brief Timestamped detector event, returned from pop_event() of detector/classifier reports.
+template <typename T>
+using bno08x_event_t = bno08x_history_entry_t<T>;
+
 /// @brief Struct to represent sensor/report meta data, returned from BNO08xRpt::get_meta_data()
 typedef struct bno08x_meta_data_t
 {
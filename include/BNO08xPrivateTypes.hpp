@@ -8,19 +8,343 @@
 // etl includes
 #include <etl/vector.h>
 #include <etl/variant.h>
+#include <etl/largest.h>
+#include <etl/utility.h>
+#include <etl/circular_buffer.h>
 // esp-idf includes
 #include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <freertos/semphr.h>
 #include <freertos/event_groups.h>
+#include <freertos/queue.h>
+#include <driver/gpio.h>
 // in-house includes
 #include "BNO08xGlobalTypes.hpp"
 #include "BNO08xCbParamRptID.hpp"
 #include "BNO08xCbParamVoid.hpp"
+#include "BNO08xCbParamData.hpp"
+#include "BNO08xSubscriber.hpp"
+#include "BNO08xAllocator.hpp"
+
+class BNO08xRpt;
+class BNO08x;
 
 namespace BNO08xPrivateTypes
 {
-    using bno08x_cb_list_t = etl::vector<etl::variant<BNO08xCbParamVoid, BNO08xCbParamRptID>,
-            CONFIG_ESP32_BNO08X_CB_MAX>; ///< Alias for vector type to contain both cb flavors.
+    using bno08x_cb_list_t = etl::vector<etl::variant<BNO08xCbParamVoid, BNO08xCbParamRptID, BNO08xCbParamData>,
+            CONFIG_ESP32_BNO08X_CB_MAX>; ///< Alias for vector type to contain all cb flavors.
+
+    /// @brief Size of the largest report sample that can be passed to cb_task() with a callback event.
+    static const constexpr size_t RPT_DATA_MAX_SZ = BNO08X_SAMPLE_MAX_SZ;
+
+    /**
+     * @brief Converts a configured timeout to ticks with pdMS_TO_TICKS(), rounding up to 1 tick such that timeouts
+     * shorter than a tick period still block instead of expiring immediately.
+     *
+     * @param ms Timeout in milliseconds.
+     *
+     * @return Timeout in ticks, at least 1.
+     */
+    static constexpr TickType_t ms_to_ticks(uint32_t ms)
+    {
+        return (pdMS_TO_TICKS(ms) == 0U) ? 1U : pdMS_TO_TICKS(ms);
+    }
+
+    /// @brief Worker that executes every callback registered to all reports (BNO08x::register_cb()), such that they
+    /// never execute concurrently regardless of which workers the reports are assigned to.
+    static const constexpr uint8_t CB_WORKER_GLOBAL = 0U;
+
+    /// @brief Dispatch lists a callback event is executed against, see BNO08x::handle_cb().
+    enum bno08x_cb_evt_scope_t : uint8_t
+    {
+        CB_EVT_SCOPE_GLOBAL = (1U << 0U), ///< Callbacks registered to all reports, only sent to CB_WORKER_GLOBAL.
+        CB_EVT_SCOPE_RPT = (1U << 1U)     ///< Callbacks registered to the report, sent to the report's worker.
+    };
+
+    /// @brief Callback event sent from data_proc_task() to cb_task(), carries the sample that triggered it.
+    typedef struct bno08x_cb_evt_t
+    {
+            BNO08xRpt* rpt;                                ///< Report the sample belongs to, nullptr to wake cb_task() only.
+            uint8_t scope;                                 ///< Dispatch lists to execute, bno08x_cb_evt_scope_t bits.
+            alignas(8) uint8_t rpt_data[RPT_DATA_MAX_SZ]; ///< Copy of the report sample passed to data carrying callbacks.
+    } bno08x_cb_evt_t;
+
+    /// @brief Amount of tasks launched by BNO08x::init_tasks().
+    static const constexpr uint8_t TASK_COUNT = 3U + CONFIG_ESP32_BNO08X_CB_WORKER_COUNT;
+
+    /// @brief Max amount of buffers the user can allocate with BNO08x::allocate(), ex. one history buffer per report.
+    static const constexpr size_t USR_ALLOC_MAX = TOTAL_RPT_COUNT;
+
+    /// @brief Allocations of bno08x_mem_ctx_t::create_queue(), control block and item storage.
+    static const constexpr size_t MEM_ALLOCS_QUEUE = 2U;
+
+    /// @brief Allocations of a semaphore, mutex or event group created by bno08x_mem_ctx_t, its control block.
+    static const constexpr size_t MEM_ALLOCS_KERNEL_OBJ = 1U;
+
+    /// @brief Allocations of bno08x_mem_ctx_t::create_task(), stack and TCB.
+    static const constexpr size_t MEM_ALLOCS_TASK = 2U;
+
+    /// @brief Allocations of bno08x_sync_ctx_t: sh2_HAL_lock, data_lock, cb_list_lock, hint_route.sem_hint, its 4
+    /// event groups and the sem_delivered of each get_next() waiter.
+    static const constexpr size_t MEM_ALLOCS_SYNC_CTX =
+            (4U + 4U + CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX) * MEM_ALLOCS_KERNEL_OBJ;
+
+    /// @brief Allocations of bno08x_cb_worker_t::create(): queue_cb_evt, queue_cb_evt_low and sem_cb_evt.
+    static const constexpr size_t MEM_ALLOCS_CB_WORKER = (2U * MEM_ALLOCS_QUEUE) + MEM_ALLOCS_KERNEL_OBJ;
+
+    /// @brief Allocations made while constructing BNO08x: sync_ctx, its callback workers, the two sensor event queues
+    /// and sem_kill_tasks. Checked against the allocations actually made by the constructor.
+    static const constexpr size_t MEM_ALLOCS_CONSTRUCTION = MEM_ALLOCS_SYNC_CTX +
+                                                            (CONFIG_ESP32_BNO08X_CB_WORKER_COUNT * MEM_ALLOCS_CB_WORKER) +
+                                                            (2U * MEM_ALLOCS_QUEUE) + MEM_ALLOCS_KERNEL_OBJ;
+
+    /// @brief Max amount of allocations tracked by bno08x_mem_ctx_t: construction, the sem_wake of each subscriber,
+    /// task stacks & TCBs and user buffers.
+    static const constexpr size_t MEM_ALLOC_MAX = MEM_ALLOCS_CONSTRUCTION +
+                                                  (CONFIG_ESP32_BNO08X_SUBSCRIBER_MAX * MEM_ALLOCS_KERNEL_OBJ) +
+                                                  (TASK_COUNT * MEM_ALLOCS_TASK) + USR_ALLOC_MAX;
+
+    /// @brief Stack and TCB storage of a task, allocated on first launch and reused if the task is relaunched.
+    typedef struct bno08x_task_mem_t
+    {
+            StackType_t* stack; ///< Stack storage, nullptr until allocated.
+            StaticTask_t* tcb;  ///< TCB storage, nullptr until allocated.
+
+            bno08x_task_mem_t()
+                : stack(nullptr)
+                , tcb(nullptr)
+            {
+            }
+    } bno08x_task_mem_t;
+
+    /// @brief Obtains driver storage from the user's BNO08xAllocator and tracks it such that all of it is released at
+    /// once when the driver is destroyed.
+    typedef struct bno08x_mem_ctx_t
+    {
+            BNO08xAllocator* allocator;                 ///< Allocator all driver storage is obtained from.
+            etl::vector<void*, MEM_ALLOC_MAX> allocs;   ///< Blocks obtained from allocator, released by release_all().
+
+            bno08x_mem_ctx_t(BNO08xAllocator* allocator)
+                : allocator((allocator != nullptr) ? allocator : &BNO08xHeapAllocator::default_allocator())
+            {
+            }
+
+            /**
+             * @brief Allocates a tracked block from the allocator.
+             *
+             * @param size Size of the block in bytes.
+             * @param alignment Required alignment of the block in bytes.
+             * @param region Memory region the block should be placed in.
+             *
+             * @return Pointer to the block, nullptr if out of memory or MEM_ALLOC_MAX blocks are already tracked.
+             */
+            void* allocate(size_t size, size_t alignment, BNO08xMemRegion region)
+            {
+                void* ptr = nullptr;
+
+                if (allocs.full())
+                    return nullptr;
+
+                ptr = allocator->allocate(size, alignment, region);
+
+                if (ptr != nullptr)
+                    allocs.push_back(ptr);
+
+                return ptr;
+            }
+
+            /**
+             * @brief Allocates tracked storage for a single object of type T.
+             *
+             * @param region Memory region the object should be placed in.
+             *
+             * @return Pointer to the uninitialized storage, nullptr if out of memory.
+             */
+            template <typename T>
+            T* allocate(BNO08xMemRegion region = BNO08xMemRegion::HOT)
+            {
+                return static_cast<T*>(allocate(sizeof(T), alignof(T), region));
+            }
+
+            /**
+             * @brief Releases every tracked block, in reverse order of allocation.
+             *
+             * @return void, nothing to return
+             */
+            void release_all()
+            {
+                while (!allocs.empty())
+                {
+                    allocator->deallocate(allocs.back());
+                    allocs.pop_back();
+                }
+            }
+
+            /**
+             * @brief Creates a queue with its control block and item storage obtained from the allocator.
+             *
+             * @param length Max amount of items in the queue.
+             * @param item_sz Size of each item in bytes.
+             * @param region Memory region of the item storage.
+             *
+             * @return Handle to the queue, NULL if out of memory.
+             */
+            QueueHandle_t create_queue(UBaseType_t length, UBaseType_t item_sz, BNO08xMemRegion region)
+            {
+                StaticQueue_t* buffer = allocate<StaticQueue_t>();
+                uint8_t* storage = static_cast<uint8_t*>(allocate(length * item_sz, alignof(uint64_t), region));
+
+                if ((buffer == nullptr) || (storage == nullptr))
+                    return NULL;
+
+                return xQueueCreateStatic(length, item_sz, storage, buffer);
+            }
+
+            /**
+             * @brief Creates a mutex with its control block obtained from the allocator.
+             *
+             * @return Handle to the mutex, NULL if out of memory.
+             */
+            SemaphoreHandle_t create_mutex()
+            {
+                StaticSemaphore_t* buffer = allocate<StaticSemaphore_t>();
+
+                return (buffer != nullptr) ? xSemaphoreCreateMutexStatic(buffer) : NULL;
+            }
+
+            /**
+             * @brief Creates a binary semaphore with its control block obtained from the allocator.
+             *
+             * @return Handle to the semaphore, NULL if out of memory.
+             */
+            SemaphoreHandle_t create_binary_semaphore()
+            {
+                StaticSemaphore_t* buffer = allocate<StaticSemaphore_t>();
+
+                return (buffer != nullptr) ? xSemaphoreCreateBinaryStatic(buffer) : NULL;
+            }
+
+            /**
+             * @brief Creates a counting semaphore with its control block obtained from the allocator.
+             *
+             * @param max_count Max count of the semaphore.
+             * @param initial_count Initial count of the semaphore.
+             *
+             * @return Handle to the semaphore, NULL if out of memory.
+             */
+            SemaphoreHandle_t create_counting_semaphore(UBaseType_t max_count, UBaseType_t initial_count)
+            {
+                StaticSemaphore_t* buffer = allocate<StaticSemaphore_t>();
+
+                return (buffer != nullptr) ? xSemaphoreCreateCountingStatic(max_count, initial_count, buffer) : NULL;
+            }
+
+            /**
+             * @brief Creates an event group with its control block obtained from the allocator.
+             *
+             * @return Handle to the event group, NULL if out of memory.
+             */
+            EventGroupHandle_t create_event_group()
+            {
+                StaticEventGroup_t* buffer = allocate<StaticEventGroup_t>();
+
+                return (buffer != nullptr) ? xEventGroupCreateStatic(buffer) : NULL;
+            }
+
+            /**
+             * @brief Launches a task with its stack and TCB obtained from the allocator.
+             *
+             * @param task_mem Stack and TCB storage of the task, allocated on the task's first launch.
+             * @param task_fxn Task function.
+             * @param name Task name.
+             * @param stack_sz Stack depth of the task.
+             * @param arg Argument passed to task_fxn.
+             * @param priority Task priority.
+             * @param core_id Core the task is pinned to, tskNO_AFFINITY for none.
+             *
+             * @return Handle to the task, NULL if out of memory.
+             */
+            TaskHandle_t create_task(bno08x_task_mem_t& task_mem, TaskFunction_t task_fxn, const char* name, uint32_t stack_sz,
+                    void* arg, UBaseType_t priority, BaseType_t core_id)
+            {
+                if (task_mem.stack == nullptr)
+                    task_mem.stack = static_cast<StackType_t*>(
+                            allocate(stack_sz * sizeof(StackType_t), alignof(uint64_t), BNO08xMemRegion::HOT));
+
+                if (task_mem.tcb == nullptr)
+                    task_mem.tcb = allocate<StaticTask_t>();
+
+                if ((task_mem.stack == nullptr) || (task_mem.tcb == nullptr))
+                    return NULL;
+
+                return xTaskCreateStaticPinnedToCore(task_fxn, name, stack_sz, arg, priority, task_mem.stack, task_mem.tcb, core_id);
+            }
+    } bno08x_mem_ctx_t;
+
+    /// @brief Callback worker, one cb_task() instance with its own callback queues.
+    typedef struct bno08x_cb_worker_t
+    {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+            StaticQueue_t queue_cb_evt_buffer;                    ///< Storage for queue_cb_evt.
+            uint8_t queue_cb_evt_storage[CONFIG_ESP32_BNO08X_CB_QUEUE_SZ * sizeof(bno08x_cb_evt_t)]; ///< Item storage for queue_cb_evt.
+            StaticQueue_t queue_cb_evt_low_buffer;                ///< Storage for queue_cb_evt_low.
+            uint8_t queue_cb_evt_low_storage[CONFIG_ESP32_BNO08X_CB_QUEUE_SZ * sizeof(bno08x_cb_evt_t)]; ///< Item storage for queue_cb_evt_low.
+            StaticSemaphore_t sem_cb_evt_buffer;                  ///< Storage for sem_cb_evt.
+            #endif
+            // clang-format on
+
+            QueueHandle_t queue_cb_evt;     ///< Queue to send callback events of BNO08xLane::HIGH reports to this worker.
+            QueueHandle_t queue_cb_evt_low; ///< Queue to send callback events of BNO08xLane::LOW reports to this worker.
+            SemaphoreHandle_t sem_cb_evt;   ///< Given after sending to either callback queue to wake this worker.
+            BNO08x* imu;                    ///< IMU this worker executes callbacks for, set when its task is launched.
+
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+            bno08x_cb_worker_t()
+                : queue_cb_evt(xQueueCreateStatic(CONFIG_ESP32_BNO08X_CB_QUEUE_SZ, sizeof(bno08x_cb_evt_t), queue_cb_evt_storage,
+                          &queue_cb_evt_buffer))
+                , queue_cb_evt_low(xQueueCreateStatic(CONFIG_ESP32_BNO08X_CB_QUEUE_SZ, sizeof(bno08x_cb_evt_t),
+                          queue_cb_evt_low_storage, &queue_cb_evt_low_buffer))
+                , sem_cb_evt(xSemaphoreCreateBinaryStatic(&sem_cb_evt_buffer))
+                , imu(nullptr)
+            {
+            }
+            #else
+            bno08x_cb_worker_t()
+                : queue_cb_evt(NULL)
+                , queue_cb_evt_low(NULL)
+                , sem_cb_evt(NULL)
+                , imu(nullptr)
+            {
+            }
+
+            /**
+             * @brief Creates the worker's queues and semaphore with storage obtained from the driver's allocator.
+             *
+             * @param mem Memory context of the driver.
+             *
+             * @return void, nothing to return
+             */
+            void create(bno08x_mem_ctx_t& mem)
+            {
+                queue_cb_evt = mem.create_queue(CONFIG_ESP32_BNO08X_CB_QUEUE_SZ, sizeof(bno08x_cb_evt_t), BNO08xMemRegion::BULK);
+                queue_cb_evt_low = mem.create_queue(CONFIG_ESP32_BNO08X_CB_QUEUE_SZ, sizeof(bno08x_cb_evt_t), BNO08xMemRegion::BULK);
+                sem_cb_evt = mem.create_binary_semaphore();
+            }
+            #endif
+            // clang-format on
+
+            /**
+             * @brief Checks if the worker's queues and semaphore were created.
+             *
+             * @return True if every kernel object of the worker was created.
+             */
+            bool created() const
+            {
+                return (queue_cb_evt != NULL) && (queue_cb_evt_low != NULL) && (sem_cb_evt != NULL);
+            }
+    } bno08x_cb_worker_t;
 
     /// @brief Holds info about which functionality has been successfully initialized (used by
     /// deconstructor during cleanup).
@@ -33,8 +357,9 @@ namespace BNO08xPrivateTypes
             bool spi_bus;              ///< True if spi_bus_initialize() has been called successfully.
             bool spi_device;           ///< True if spi_bus_add_device() has been called successfully.
             bool data_proc_task;       ///< True if xTaskCreate has been called successfully for data_proc_task.
+            bool data_proc_low_task;   ///< True if xTaskCreate has been called successfully for data_proc_low_task.
             bool sh2_HAL_service_task; ///< True if xTaskCreate has been called successfully for sh2_HAL_service_task.
-            bool cb_task;              ///< True if xTaskCreate has been called successfully for cb_task.
+            uint8_t cb_task;           ///< Amount of cb_task() workers xTaskCreate has been called successfully for.
             bool sh2_HAL;              ///< True if sh2_open() has been called successfully.
 
             bno08x_init_status_t()
@@ -45,16 +370,237 @@ namespace BNO08xPrivateTypes
                 , spi_bus(false)
                 , spi_device(false)
                 , data_proc_task(false)
+                , data_proc_low_task(false)
                 , sh2_HAL_service_task(false)
-                , cb_task(false)
+                , cb_task(0U)
                 , sh2_HAL(false)
             {
             }
     } bno08x_init_status_t;
 
+    /// @brief Tracks IMU resets to measure recovery, shared by BNO08xSH2HAL callbacks and sh2_HAL_service_task(). Only
+    /// last_sample_us is accessed without user data locked, by the sh2_HAL_lock holder.
+    typedef struct bno08x_reset_tracker_t
+    {
+            int64_t last_sample_us;  ///< Time the most recent sensor event was received.
+            int64_t reset_detected_us; ///< Time the reset being recovered from was detected.
+            int64_t outage_start_us; ///< Time data stopped flowing for the reset being recovered from.
+            int64_t first_sample_us; ///< Time of the first sensor event after the reset, 0 until received.
+            float rate_sum_hz;       ///< Sum of the rates of reports enabled during recovery, used to estimate lost samples.
+            uint8_t rpt_count;       ///< Amount of reports enabled during recovery.
+            bool awaiting_sample;    ///< True from reset detection until the first sensor event after it.
+            bool entry_incomplete;   ///< True if the newest log entry still awaits the first sample after its reset.
+            bool entry_pending;      ///< True if the newest log entry still awaits its reason and recovery time from BNO08x::recover_from_reset().
+            uint32_t reset_count;    ///< Total resets detected, including those rotated out of log.
+            etl::circular_buffer<bno08x_reset_log_entry_t, CONFIG_ESP32_BNO08X_RESET_LOG_SZ>
+                    log; ///< Most recent resets, oldest first.
+
+            bno08x_reset_tracker_t()
+                : last_sample_us(0LL)
+                , reset_detected_us(0LL)
+                , outage_start_us(0LL)
+                , first_sample_us(0LL)
+                , rate_sum_hz(0.0f)
+                , rpt_count(0U)
+                , awaiting_sample(false)
+                , entry_incomplete(false)
+                , entry_pending(false)
+                , reset_count(0UL)
+            {
+            }
+
+            /**
+             * @brief Fills in the downtime and estimated lost samples of a log entry once the first sample after its
+             * reset was received.
+             *
+             * @param entry The log entry to complete.
+             *
+             * @return void, nothing to return
+             */
+            void complete(bno08x_reset_log_entry_t& entry) const
+            {
+                float expected = 0.0f;
+
+                entry.downtime_us = static_cast<uint32_t>(first_sample_us - outage_start_us);
+
+                // every report's first sample after the reset is received, only those before it were lost
+                expected = (static_cast<float>(entry.downtime_us) / 1000000.0f) * rate_sum_hz - static_cast<float>(rpt_count);
+                entry.samples_lost = (expected > 0.0f) ? static_cast<uint32_t>(expected) : 0UL;
+            }
+    } bno08x_reset_tracker_t;
+
+    /// @brief Hub settings which are lost when the BNO08x resets, re-applied by BNO08x::restore_hub_cfg().
+    typedef struct bno08x_hub_cfg_t
+    {
+            bool cal_config_set;   ///< True if the dynamic calibration config was set by the user.
+            uint8_t cal_config;    ///< Sensors with dynamic calibration enabled (BNO08xCalSel bits).
+            bool dcd_autosave_set; ///< True if dynamic calibration data autosave was set by the user.
+            bool dcd_autosave;     ///< Dynamic calibration data autosave setting.
+
+            bno08x_hub_cfg_t()
+                : cal_config_set(false)
+                , cal_config(0U)
+                , dcd_autosave_set(false)
+                , dcd_autosave(false)
+            {
+            }
+    } bno08x_hub_cfg_t;
+
+    static const constexpr UBaseType_t HINT_NOTIFY_INDEX =
+            CONFIG_ESP32_BNO08X_HINT_NOTIFY_INDEX; ///< Task notification index HINT assertions are delivered to driver tasks on.
+
+    static_assert(HINT_NOTIFY_INDEX < configTASK_NOTIFICATION_ARRAY_ENTRIES,
+            "ESP32_BNO08X_HINT_NOTIFY_INDEX must be less than FREERTOS_TASK_NOTIFICATION_ARRAY_ENTRIES.");
+
+    /// @brief A task blocked in BNO08xRpt::get_next(), data_proc_task() writes it the next sample of its report.
+    typedef struct bno08x_next_waiter_t
+    {
+            bool in_use;             ///< True from the waiting task claiming the waiter until it returns.
+            BNO08xRpt* rpt;          ///< Report waited on, nullptr once the sample was delivered.
+            SemaphoreHandle_t sem_delivered; ///< Given by data_proc_task() once the sample was delivered, never a task notification.
+            void* entry;             ///< Destination of the sample (bno08x_history_entry_t of the report's sample type).
+            volatile bool delivered; ///< Set by data_proc_task() once entry holds the sample.
+
+            bno08x_next_waiter_t()
+                : in_use(false)
+                , rpt(nullptr)
+                , sem_delivered(NULL)
+                , entry(nullptr)
+                , delivered(false)
+            {
+            }
+    } bno08x_next_waiter_t;
+
+    /// @brief Routes HINT assertions from BNO08x::hint_handler() directly to the task that owns the SPI transport.
+    ///
+    /// The holder of sh2_HAL_lock owns the transport, sh2_HAL_service_task() owns it while the lock is free. The
+    /// BNO08x holds HINT asserted until the owner's transaction asserts CS, such that the HINT level, not the
+    /// notification, is what waiters act on. An assertion notified to the previous owner during a hand over is not lost.
+    /// Only sh2_HAL_service_task() is woken with a task notification, user tasks calling driver APIs are woken through
+    /// sem_hint such that their own task notifications are never given or consumed by the driver.
+    typedef struct bno08x_hint_route_t
+    {
+            TaskHandle_t volatile owner; ///< Task notified by BNO08x::hint_handler(), NULL if HINTs are not delivered.
+            TaskHandle_t service_task;   ///< sh2_HAL_service_task() handle, owner while sh2_HAL_lock is free.
+            SemaphoreHandle_t sem_hint;  ///< Given by BNO08x::hint_handler() while a user task owns the transport.
+            gpio_num_t io_int;           ///< HINT GPIO.
+            volatile BNO08xHintMode mode; ///< How sh2_HAL_service_task() waits for HINT.
+            volatile bool polling; ///< True while sh2_HAL_service_task() spins on HINT, BNO08x::hint_handler() does not wake it.
+            volatile uint32_t hint_us; ///< Time of the most recent HINT assertion (lower 32 bits of esp_timer), sh2 HAL lib rx timestamp.
+            volatile bool suspended; ///< True while the driver is suspended, HINT is disabled and not serviced.
+
+            bno08x_hint_route_t()
+                : owner(NULL)
+                , service_task(NULL)
+                , sem_hint(NULL)
+                , io_int(GPIO_NUM_NC)
+                , mode(BNO08xHintMode::INTERRUPT)
+                , polling(false)
+                , hint_us(0UL)
+                , suspended(false)
+            {
+            }
+
+            /**
+             * @brief Checks if the BNO08x is currently asserting HINT.
+             *
+             * @return True if HINT is asserted (active low).
+             */
+            bool asserted() const
+            {
+                return (io_int != GPIO_NUM_NC) && (gpio_get_level(io_int) == 0);
+            }
+
+            /**
+             * @brief Makes the calling task the HINT owner, called right after sh2_HAL_lock is taken.
+             *
+             * @return void, nothing to return
+             */
+            void claim()
+            {
+                owner = xTaskGetCurrentTaskHandle();
+            }
+
+            /**
+             * @brief Hands HINTs back to sh2_HAL_service_task(), called right before sh2_HAL_lock is given.
+             *
+             * @return void, nothing to return
+             */
+            void release()
+            {
+                owner = service_task;
+
+                // drop a give left by HINTs the user task's own transactions serviced
+                if ((xTaskGetCurrentTaskHandle() != service_task) && (sem_hint != NULL))
+                    xSemaphoreTake(sem_hint, 0);
+
+                // an assertion that arrived while this task owned the transport is still pending, hand it over
+                if (!suspended && asserted() && (service_task != NULL))
+                    xTaskNotifyGiveIndexed(service_task, HINT_NOTIFY_INDEX);
+            }
+    } bno08x_hint_route_t;
+
+    /// @brief Escalation state of HINT timeout recovery, see BNO08x::wait_for_hint_recover().
+    typedef struct bno08x_hint_recovery_t
+    {
+            bno08x_hint_recovery_stats_t stats; ///< Counts of timeouts and escalations.
+            bool soft_reset_issued; ///< True from requesting a soft reset until data flows again, the next stuck hub is hard reset.
+
+            bno08x_hint_recovery_t()
+                : soft_reset_issued(false)
+            {
+            }
+    } bno08x_hint_recovery_t;
+
+    /// @brief Amount of tasks walking dispatch lists, every cb_task() worker followed by the HIGH and LOW lane
+    /// data_proc_task() instances (inline callbacks).
+    static const constexpr uint8_t CB_DISPATCHER_COUNT = CONFIG_ESP32_BNO08X_CB_WORKER_COUNT + 2U;
+
+    /**
+     * @brief Returns the dispatcher index of the data_proc_task() instance of a lane, which executes
+     * BNO08xCbExec::INLINE callbacks of the reports in that lane.
+     *
+     * @param lane Lane processed by the data_proc_task() instance.
+     *
+     * @return The dispatcher index.
+     */
+    inline constexpr uint8_t cb_dispatcher_inline(BNO08xLane lane)
+    {
+        return CONFIG_ESP32_BNO08X_CB_WORKER_COUNT + static_cast<uint8_t>(lane);
+    }
+
+    /// @brief Bookkeeping of a cb_list entry, kept outside of the entry such that it survives the entry being reused.
+    typedef struct bno08x_cb_slot_t
+    {
+            uint16_t gen; ///< Incremented every time a callback is stored in the slot, handles of previous callbacks no longer match.
+            BNO08xCbGeneric* volatile* list_head; ///< Head of the dispatch list the callback is linked into.
+            uint32_t retire_epoch;                ///< Value of cb_epoch when the callback was unregistered.
+
+            bno08x_cb_slot_t()
+                : gen(0U)
+                , list_head(nullptr)
+                , retire_epoch(0UL)
+            {
+            }
+    } bno08x_cb_slot_t;
+
     /// @brief Holds context used to synchronize tasks and callback execution.
     typedef struct bno08x_sync_ctx_t
     {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+            StaticSemaphore_t sh2_HAL_lock_buffer;                ///< Storage for sh2_HAL_lock.
+            StaticSemaphore_t data_lock_buffer;                   ///< Storage for data_lock.
+            StaticSemaphore_t cb_list_lock_buffer;                ///< Storage for cb_list_lock.
+            StaticSemaphore_t sem_hint_buffer;                    ///< Storage for hint_route.sem_hint.
+            StaticSemaphore_t next_waiter_sem_buffers[CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX]; ///< Storage for next_waiters[].sem_delivered.
+            StaticEventGroup_t evt_grp_rpt_en_buffer;             ///< Storage for evt_grp_rpt_en.
+            StaticEventGroup_t evt_grp_rpt_data_available_buffer; ///< Storage for evt_grp_rpt_data_available.
+            StaticEventGroup_t evt_grp_task_buffer;               ///< Storage for evt_grp_task.
+            StaticEventGroup_t evt_grp_rpt_cfg_ack_buffer;        ///< Storage for evt_grp_rpt_cfg_ack.
+            #endif
+            // clang-format on
+
             SemaphoreHandle_t sh2_HAL_lock; ///<Mutex to prevent sh2 HAL lib functions from being accessed at same time.
             SemaphoreHandle_t
                     data_lock; ///<Mutex to prevent user from reading data while data_proc_task() updates it, and vice versa.
@@ -62,19 +608,340 @@ namespace BNO08xPrivateTypes
             EventGroupHandle_t
                     evt_grp_rpt_data_available; ///< Event group for indicating to BNO08xRpt::has_new_data() that a module received a new report.
             EventGroupHandle_t evt_grp_task; ///<Event group for indicating various BNO08x related events between tasks.
+            EventGroupHandle_t
+                    evt_grp_rpt_cfg_ack; ///< Event group for indicating a report's Get Feature Response was received after its config was set.
+            bno08x_cb_worker_t cb_workers[CONFIG_ESP32_BNO08X_CB_WORKER_COUNT]; ///< Callback workers, reports are assigned with BNO08xRpt::set_cb_worker().
             etl::vector<uint8_t, TOTAL_RPT_COUNT> en_report_ids; ///< Vector to contain IDs of currently enabled reports
             bno08x_cb_list_t cb_list;                            ///< Vector to contain registered callbacks.
+            BNO08xCbGeneric* volatile cb_list_head; ///< Dispatch list of callbacks registered to all reports (linked through cb_list).
+            BNO08xCbGeneric* volatile cb_list_inline_head; ///< Dispatch list of BNO08xCbExec::INLINE callbacks registered to all reports.
+            SemaphoreHandle_t cb_list_lock; ///< Mutex serializing callback (un)registration, never taken by dispatchers.
+            bno08x_cb_slot_t cb_slots[CONFIG_ESP32_BNO08X_CB_MAX]; ///< Bookkeeping of each cb_list entry.
+            volatile uint32_t cb_epoch; ///< Incremented by every unregistration, see cb_list_unregister().
+            volatile uint32_t cb_dispatch_epoch[CB_DISPATCHER_COUNT]; ///< cb_epoch when each dispatcher began walking dispatch lists, 0 while idle.
+            bno08x_drop_stats_t drop_stats; ///< Per stage counts of lost samples.
+            BNO08xSubscriber subscribers[CONFIG_ESP32_BNO08X_SUBSCRIBER_MAX]; ///< Pool handed out by BNO08x::create_subscriber().
+            bno08x_next_waiter_t next_waiters[CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX]; ///< Tasks blocked in BNO08xRpt::get_next(), guarded by data_lock.
+            bno08x_reset_tracker_t reset_tracker; ///< Reset log and state used to measure recovery from resets.
+            bno08x_hint_route_t hint_route;       ///< Task HINT assertions are currently delivered to.
+            bno08x_hint_recovery_t hint_recovery; ///< HINT timeout escalation state, only accessed by the sh2_HAL_lock holder.
 
-            bno08x_sync_ctx_t()
-                : sh2_HAL_lock(xSemaphoreCreateMutex())
-                , data_lock(xSemaphoreCreateMutex())
-                , evt_grp_rpt_en(xEventGroupCreate())
-                , evt_grp_rpt_data_available(xEventGroupCreate())
-                , evt_grp_task(xEventGroupCreate())
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+            bno08x_sync_ctx_t(bno08x_mem_ctx_t&)
+                : sh2_HAL_lock(xSemaphoreCreateMutexStatic(&sh2_HAL_lock_buffer))
+                , data_lock(xSemaphoreCreateMutexStatic(&data_lock_buffer))
+                , evt_grp_rpt_en(xEventGroupCreateStatic(&evt_grp_rpt_en_buffer))
+                , evt_grp_rpt_data_available(xEventGroupCreateStatic(&evt_grp_rpt_data_available_buffer))
+                , evt_grp_task(xEventGroupCreateStatic(&evt_grp_task_buffer))
+                , evt_grp_rpt_cfg_ack(xEventGroupCreateStatic(&evt_grp_rpt_cfg_ack_buffer))
+                , cb_list_head(nullptr)
+                , cb_list_inline_head(nullptr)
+                , cb_list_lock(xSemaphoreCreateMutexStatic(&cb_list_lock_buffer))
+                , cb_epoch(1UL)
+                , cb_dispatch_epoch{}
             {
+                hint_route.sem_hint = xSemaphoreCreateBinaryStatic(&sem_hint_buffer);
+
+                for (size_t i = 0; i < CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX; i++)
+                    next_waiters[i].sem_delivered = xSemaphoreCreateBinaryStatic(&next_waiter_sem_buffers[i]);
+            }
+            #else
+            bno08x_sync_ctx_t(bno08x_mem_ctx_t& mem)
+                : sh2_HAL_lock(mem.create_mutex())
+                , data_lock(mem.create_mutex())
+                , evt_grp_rpt_en(mem.create_event_group())
+                , evt_grp_rpt_data_available(mem.create_event_group())
+                , evt_grp_task(mem.create_event_group())
+                , evt_grp_rpt_cfg_ack(mem.create_event_group())
+                , cb_list_head(nullptr)
+                , cb_list_inline_head(nullptr)
+                , cb_list_lock(mem.create_mutex())
+                , cb_epoch(1UL)
+                , cb_dispatch_epoch{}
+            {
+                hint_route.sem_hint = mem.create_binary_semaphore();
+
+                for (bno08x_next_waiter_t& waiter : next_waiters)
+                    waiter.sem_delivered = mem.create_binary_semaphore();
+
+                for (bno08x_cb_worker_t& worker : cb_workers)
+                    worker.create(mem);
+            }
+            #endif
+            // clang-format on
+
+            /**
+             * @brief Checks if every kernel object was created, the driver's allocator may have run out of memory.
+             *
+             * @return True if every kernel object was created.
+             */
+            bool created() const
+            {
+                if ((sh2_HAL_lock == NULL) || (data_lock == NULL) || (cb_list_lock == NULL) || (hint_route.sem_hint == NULL))
+                    return false;
+
+                if ((evt_grp_rpt_en == NULL) || (evt_grp_rpt_data_available == NULL) || (evt_grp_task == NULL) ||
+                        (evt_grp_rpt_cfg_ack == NULL))
+                    return false;
+
+                for (const bno08x_cb_worker_t& worker : cb_workers)
+                    if (!worker.created())
+                        return false;
+
+                for (const bno08x_next_waiter_t& waiter : next_waiters)
+                    if (waiter.sem_delivered == NULL)
+                        return false;
+
+                return true;
             }
     } bno08x_sync_ctx_t;
 
+    /**
+     * @brief Returns the callback stored at an index of cb_list as its generic type, registered or not.
+     *
+     * @param cb_list Vector that owns registered callbacks.
+     * @param cb_idx Index of the entry in cb_list.
+     *
+     * @return Pointer to the callback, nullptr if cb_idx is out of range.
+     */
+    inline BNO08xCbGeneric* cb_list_entry(bno08x_cb_list_t& cb_list, size_t cb_idx)
+    {
+        BNO08xCbGeneric* cb_entry = nullptr;
+
+        if (cb_idx >= cb_list.size())
+            return nullptr;
+
+        cb_entry = etl::get_if<BNO08xCbParamVoid>(&cb_list[cb_idx]);
+
+        if (cb_entry == nullptr)
+            cb_entry = etl::get_if<BNO08xCbParamRptID>(&cb_list[cb_idx]);
+
+        if (cb_entry == nullptr)
+            cb_entry = etl::get_if<BNO08xCbParamData>(&cb_list[cb_idx]);
+
+        return cb_entry;
+    }
+
+    /**
+     * @brief Returns a registered callback as its generic type.
+     *
+     * @param sync_ctx Context of the IMU the callback is registered to.
+     * @param cb_idx Index of the callback, see bno08x_cb_handle_t::idx.
+     *
+     * @return Pointer to the callback, nullptr if cb_idx is out of range or its callback was unregistered.
+     */
+    inline BNO08xCbGeneric* cb_list_at(bno08x_sync_ctx_t& sync_ctx, size_t cb_idx)
+    {
+        BNO08xCbGeneric* cb_entry = cb_list_entry(sync_ctx.cb_list, cb_idx);
+
+        if ((cb_entry == nullptr) || !cb_entry->registered)
+            return nullptr;
+
+        return cb_entry;
+    }
+
+    /**
+     * @brief Returns the callback a handle refers to as its generic type.
+     *
+     * Must be called with cb_list_lock held, such that the callback cannot be unregistered and its slot reused while
+     * the caller uses it.
+     *
+     * @param sync_ctx Context of the IMU the callback is registered to.
+     * @param handle Handle returned when the callback was registered.
+     *
+     * @return Pointer to the callback, nullptr if the handle is invalid, its callback was unregistered or its slot
+     * has since been reused by another callback.
+     */
+    inline BNO08xCbGeneric* cb_list_lookup(bno08x_sync_ctx_t& sync_ctx, bno08x_cb_handle_t handle)
+    {
+        BNO08xCbGeneric* cb_entry = nullptr;
+
+        if (!handle.valid())
+            return nullptr;
+
+        cb_entry = cb_list_at(sync_ctx, handle.idx);
+
+        if ((cb_entry == nullptr) || (sync_ctx.cb_slots[handle.idx].gen != handle.gen))
+            return nullptr;
+
+        return cb_entry;
+    }
+
+    /**
+     * @brief Checks if an unregistered callback's cb_list entry can be reused.
+     *
+     * The entry is unlinked when unregistered, but a dispatcher which began walking its dispatch list before then
+     * may still be visiting it. Such a dispatcher's cb_dispatch_epoch is at most the entry's retire_epoch.
+     *
+     * @param sync_ctx Context of the IMU the callback was registered to.
+     * @param cb_idx Index of the entry in cb_list.
+     *
+     * @return True if the entry is unregistered and no dispatcher can still reach it.
+     */
+    inline bool cb_list_reclaimable(bno08x_sync_ctx_t& sync_ctx, size_t cb_idx)
+    {
+        uint32_t dispatch_epoch = 0UL;
+
+        if (cb_list_entry(sync_ctx.cb_list, cb_idx)->registered)
+            return false;
+
+        for (uint8_t i = 0; i < CB_DISPATCHER_COUNT; i++)
+        {
+            dispatch_epoch = sync_ctx.cb_dispatch_epoch[i];
+
+            if ((dispatch_epoch != 0UL) && (dispatch_epoch <= sync_ctx.cb_slots[cb_idx].retire_epoch))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Stores a callback in cb_list and links it onto the tail of a dispatch list.
+     *
+     * Dispatch lists are singly linked through BNO08xCbGeneric::next such that cb_task() only visits the
+     * callbacks interested in a given report, entries are never moved once stored in cb_list. Entries of
+     * unregistered callbacks are reused once no dispatcher can reach them anymore.
+     *
+     * @param sync_ctx Context of the IMU the callback is registered to.
+     * @param cb_list_head Head of the dispatch list to link the callback into.
+     * @param cb Callback to store.
+     *
+     * @return Handle to the callback, invalid if cb_list is full.
+     */
+    template <typename TCb>
+    bno08x_cb_handle_t cb_list_register(bno08x_sync_ctx_t& sync_ctx, BNO08xCbGeneric* volatile& cb_list_head, const TCb& cb)
+    {
+        bno08x_cb_list_t& cb_list = sync_ctx.cb_list;
+        BNO08xCbGeneric* volatile* tail = &cb_list_head;
+        BNO08xCbGeneric* cb_entry = nullptr;
+        bno08x_cb_handle_t handle;
+        size_t cb_idx = 0;
+
+        xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+        while ((cb_idx < cb_list.size()) && !cb_list_reclaimable(sync_ctx, cb_idx))
+            cb_idx++;
+
+        if (cb_idx < cb_list.size())
+            cb_list[cb_idx] = cb;
+        else if (!cb_list.full())
+            cb_list.push_back(cb);
+        else
+        {
+            xSemaphoreGive(sync_ctx.cb_list_lock);
+            return handle;
+        }
+
+        bno08x_cb_slot_t& slot = sync_ctx.cb_slots[cb_idx];
+
+        if (++slot.gen == 0U)
+            slot.gen = 1U;
+
+        slot.list_head = &cb_list_head;
+
+        cb_entry = etl::get_if<TCb>(&cb_list[cb_idx]);
+        cb_entry->registered = true;
+
+        while (*tail != nullptr)
+            tail = &((*tail)->next);
+
+        // entry must be complete before dispatchers can reach it
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        *tail = cb_entry;
+
+        handle.idx = static_cast<uint16_t>(cb_idx);
+        handle.gen = slot.gen;
+
+        xSemaphoreGive(sync_ctx.cb_list_lock);
+
+        return handle;
+    }
+
+    /**
+     * @brief Unlinks a callback from its dispatch list such that it is no longer invoked.
+     *
+     * Dispatchers are never blocked, one already visiting the callback skips it or finishes its current invocation.
+     * The entry is reused by cb_list_register() once no dispatcher can reach it anymore.
+     *
+     * @param sync_ctx Context of the IMU the callback is registered to.
+     * @param handle Handle returned when the callback was registered.
+     *
+     * @return True if the callback was unregistered, false if the handle is invalid or already unregistered.
+     */
+    inline bool cb_list_unregister(bno08x_sync_ctx_t& sync_ctx, bno08x_cb_handle_t handle)
+    {
+        BNO08xCbGeneric* cb_entry = nullptr;
+        BNO08xCbGeneric* volatile* link = nullptr;
+        bool success = false;
+
+        xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+        cb_entry = cb_list_lookup(sync_ctx, handle);
+
+        if (cb_entry != nullptr)
+        {
+            cb_entry->registered = false;
+
+            // the entry keeps its next pointer, such that dispatchers currently visiting it continue down the list
+            link = sync_ctx.cb_slots[handle.idx].list_head;
+            while (*link != cb_entry)
+                link = &((*link)->next);
+            *link = cb_entry->next;
+
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            sync_ctx.cb_slots[handle.idx].retire_epoch = sync_ctx.cb_epoch;
+            sync_ctx.cb_epoch = sync_ctx.cb_epoch + 1UL;
+            success = true;
+        }
+
+        xSemaphoreGive(sync_ctx.cb_list_lock);
+
+        return success;
+    }
+
+    /**
+     * @brief Marks a dispatcher as walking dispatch lists, such that entries it may reach are not reused.
+     *
+     * @param sync_ctx Context of the IMU the dispatcher belongs to.
+     * @param dispatcher Index of the dispatcher, a cb_task() worker index or cb_dispatcher_inline() of a lane.
+     *
+     * @return void, nothing to return
+     */
+    inline void cb_dispatch_begin(bno08x_sync_ctx_t& sync_ctx, uint8_t dispatcher)
+    {
+        sync_ctx.cb_dispatch_epoch[dispatcher] = sync_ctx.cb_epoch;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+
+    /**
+     * @brief Marks a dispatcher as idle, after it finished walking dispatch lists.
+     *
+     * @param sync_ctx Context of the IMU the dispatcher belongs to.
+     * @param dispatcher Index of the dispatcher, a cb_task() worker index or cb_dispatcher_inline() of a lane.
+     *
+     * @return void, nothing to return
+     */
+    inline void cb_dispatch_end(bno08x_sync_ctx_t& sync_ctx, uint8_t dispatcher)
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        sync_ctx.cb_dispatch_epoch[dispatcher] = 0UL;
+    }
+
+    /**
+     * @brief Increments a drop counter, several driver tasks (both lanes' data_proc_task() and
+     * sh2_HAL_service_task()) may increment the same counter concurrently.
+     *
+     * @param counter The counter to increment.
+     *
+     * @return void, nothing to return
+     */
+    inline void drop_stat_inc(uint32_t& counter)
+    {
+        __atomic_fetch_add(&counter, 1UL, __ATOMIC_RELAXED);
+    }
+
     /// @brief Bits for evt_grp_rpt_en & evt_grp_rpt_data_available
     enum bno08x_rpt_bit_t : EventBits_t
     {
@@ -111,13 +978,16 @@ namespace BNO08xPrivateTypes
                           EVT_GRP_RPT_CIRCLE_DETECTOR_BIT
     };
 
+    static_assert(EVT_GRP_RPT_ALL < (1UL << BNO08xSubscriber::RPT_SLOT_COUNT),
+            "BNO08xSubscriber::RPT_SLOT_COUNT must cover every bit in bno08x_rpt_bit_t.");
+
     /// @brief Bits for evt_grp_bno08x_task
     enum bno08x_tsk_bit_t : EventBits_t
     {
         EVT_GRP_BNO08x_TASKS_RUNNING =
                 (1UL << 0U), ///< When this bit is set it indicates the BNO08x tasks are running, it is always set to 1 for the duration of the BNO08x driver object. Cleared in the destructor for safe task deletion.
-        EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT =
-                (1UL << 1U), ///< When this bit is set it indicates the BNO08x has asserted its host interrupt pin, thus an SPI transaction should commence.
+        EVT_GRP_BNO08x_TASK_SOFT_RESET_REQUESTED =
+                (1UL << 1U), ///< When this bit is set it indicates the BNO08x is stuck and sh2_HAL_service_task() should soft reset it, set in BNO08x::wait_for_hint_recover().
         EVT_GRP_BNO08x_TASK_RESET_OCCURRED =
                 (1UL << 2U), ///< When this bit is set it indicates the SH2 HAL lib has reset the IMU, any reports enabled by the user must be re-enabled.
         EVT_GRP_BNO08x_TASK_DATA_AVAILABLE =
@@ -0,0 +1,78 @@
+/**
+ * @file BNO08xSubscriber.hpp
+ * @author Myles Parfeniuk
+ */
+
+#pragma once
+
+// standard library includes
+#include <stdint.h>
+// esp-idf includes
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <freertos/event_groups.h>
+#include "sdkconfig.h"
+// in-house includes
+#include "BNO08xGlobalTypes.hpp"
+
+class BNO08xRpt;
+
+namespace BNO08xPrivateTypes
+{
+    struct bno08x_sync_ctx_t;
+}
+
+/**
+ * @class BNO08xSubscriber
+ *
+ * @brief Consumer handle used to read reports from multiple tasks without stealing each other's notifications.
+ *
+ * Each subscriber keeps its own sequence cursor for every report it subscribed to, such that every consumer sees
+ * every update exactly once. Subscribers are obtained with BNO08x::create_subscriber() and are only woken by
+ * reports they subscribed to.
+ */
+class BNO08xSubscriber
+{
+    public:
+        bool subscribe(BNO08xRpt& rpt);
+        bool unsubscribe(BNO08xRpt& rpt);
+        bool data_available(uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+        bool has_new_data(BNO08xRpt& rpt);
+        EventBits_t wait_for(EventBits_t wait_mask, BNO08xWaitMode mode = BNO08xWaitMode::ANY,
+                uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+
+        static const constexpr uint8_t RPT_SLOT_COUNT = 22U; ///< Amount of reports with a bit in bno08x_rpt_bit_t.
+
+    private:
+        BNO08xSubscriber()
+            : in_use(false)
+            , rpt_mask(0UL)
+            , rpts{}
+            , cursors{}
+            , sem_wake(NULL)
+        {
+        }
+
+        EventBits_t pending_bits(EventBits_t wait_mask);
+        void notify(EventBits_t rpt_bit);
+        static uint8_t rpt_slot(EventBits_t rpt_bit);
+
+        bool in_use;          ///< True if handed out by BNO08x::create_subscriber().
+        EventBits_t rpt_mask; ///< Bits of subscribed reports, updated atomically as data_proc_task() reads it concurrently.
+        BNO08xRpt* rpts[RPT_SLOT_COUNT];  ///< Subscribed reports, indexed by report bit position.
+        uint32_t cursors[RPT_SLOT_COUNT]; ///< Last report sequence number seen by this subscriber, indexed by report bit position.
+        SemaphoreHandle_t sem_wake;       ///< Given by data_proc_task() when a subscribed report is received.
+
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        StaticSemaphore_t sem_wake_buffer; ///< Storage for sem_wake.
+        #endif
+        // clang-format on
+
+        static const constexpr char* TAG = "BNO08xSubscriber";
+
+        friend class BNO08x;
+        friend class BNO08xRpt;
+        friend struct BNO08xPrivateTypes::bno08x_sync_ctx_t;
+};
@@ -16,7 +16,7 @@
 class BNO08xTestHelper
 {
     private:
-        static inline uint8_t test_imu_buffer[sizeof(BNO08x)];
+        alignas(BNO08x) static inline uint8_t test_imu_buffer[sizeof(BNO08x)];
         inline static BNO08x* test_imu = nullptr;
         inline static bno08x_config_t imu_cfg;
 
@@ -109,6 +109,18 @@ class BNO08xTestHelper
             return test_imu;
         }
 
+        /**
+         * @brief Holds the test IMU in reset through its RST gpio, such that it stops asserting HINT.
+         *
+         * @param hold True to drive RST low, false to release it.
+         *
+         * @return void, nothing to return
+         */
+        static void hold_test_imu_reset(bool hold)
+        {
+            gpio_set_level(test_imu->imu_config.io_rst, hold ? 0 : 1);
+        }
+
         /**
          * @brief Used to call private BNO08x::init_config_args() member for tests.
          *
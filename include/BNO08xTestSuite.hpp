@@ -98,6 +98,7 @@ class BNO08xTestSuite
             unity_run_tests_by_tag("[CallbackAllReportVoidInputParam]", false);
             unity_run_tests_by_tag("[CallbackAllReportIDInputParam]", false);
             unity_run_tests_by_tag("[CallbackSingleReportVoidInputParam]", false);
+            unity_run_tests_by_tag("[CallbackSingleReportDataInputParam]", false);
 
             if (call_unity_end_begin)
                 UNITY_END();
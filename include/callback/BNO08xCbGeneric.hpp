@@ -7,7 +7,11 @@
 
 // standard library includes
 #include <stdint.h>
-#include <functional>
+// esp-idf includes
+#include <esp_timer.h>
+// in-house includes
+#include "BNO08xGlobalTypes.hpp"
+#include "BNO08xCbInplaceFunction.hpp"
 
 /**
  * @class BNO08xCbGeneric
@@ -18,13 +22,185 @@
 class BNO08xCbGeneric
 {
     public:
-        virtual void invoke(uint8_t rpt_ID) = 0;
+        /// @brief Budget and decimation settings of a callback, written by BNO08x setters and applied by dispatch().
+        typedef struct cfg_t
+        {
+                uint32_t budget_us;                   ///< Execution time budget in microseconds, 0 if unlimited.
+                BNO08xCbBudgetAction budget_action;   ///< Action taken when budget_us is exceeded.
+                uint32_t decimation;                  ///< Callback is invoked once every decimation samples.
+                uint32_t target_period_us;            ///< If non 0, decimation is derived from the report's period instead.
+                BNO08xDecimationMode decimation_mode; ///< Sample passed to the callback when decimated.
+
+                cfg_t()
+                    : budget_us(0UL)
+                    , budget_action(BNO08xCbBudgetAction::FLAG)
+                    , decimation(1UL)
+                    , target_period_us(0UL)
+                    , decimation_mode(BNO08xDecimationMode::LATEST)
+                {
+                }
+        } cfg_t;
+
+        virtual void invoke(uint8_t rpt_ID, const void* rpt_data) = 0;
         virtual ~BNO08xCbGeneric() = default;
+
+        /**
+         * @brief Begins an update of cfg_pending, called with cb_list_lock held such that updates never interleave.
+         *
+         * @return void, nothing to return
+         */
+        void cfg_begin()
+        {
+            // odd while cfg_pending is being written, dispatch() does not apply it
+            __atomic_store_n(&cfg_seq, cfg_seq + 1UL, __ATOMIC_RELAXED);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        }
+
+        /**
+         * @brief Publishes the update of cfg_pending begun with cfg_begin(), it is applied by the next dispatch().
+         *
+         * @return void, nothing to return
+         */
+        void cfg_commit()
+        {
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            __atomic_store_n(&cfg_seq, cfg_seq + 1UL, __ATOMIC_RELAXED);
+        }
+
+        /**
+         * @brief Invokes the callback, applying its decimation, recording its execution time and enforcing its budget.
+         *
+         * @param rpt_ID ID of report that triggered the callback.
+         * @param rpt_data Pointer to the report sample that triggered the callback.
+         * @param rpt_period_us Period the triggering report was enabled with, used to convert target_period_us.
+         *
+         * @return void, nothing to return
+         */
+        void dispatch(uint8_t rpt_ID, const void* rpt_data, uint32_t rpt_period_us)
+        {
+            int64_t start_us = 0;
+            uint32_t exec_us = 0UL;
+            uint32_t factor = decimation;
+
+            // unregistered while a dispatcher was already walking past it
+            if (!registered)
+                return;
+
+            cfg_apply();
+
+            if ((target_period_us != 0UL) && (rpt_period_us != 0UL))
+                factor = (target_period_us + (rpt_period_us / 2UL)) / rpt_period_us;
+
+            if (factor > 1UL)
+            {
+                decimation_cnt++;
+
+                if (decimation_mode == BNO08xDecimationMode::AVERAGE)
+                    rpt_data = accumulate(rpt_data, decimation_cnt);
+
+                if (decimation_cnt < factor)
+                    return;
+
+                decimation_cnt = 0UL;
+            }
+
+            if (skip_next)
+            {
+                skip_next = false;
+                stats.skips++;
+                return;
+            }
+
+            start_us = esp_timer_get_time();
+            invoke(rpt_ID, rpt_data);
+            exec_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+
+            stats.record(exec_us);
+
+            if ((budget_us != 0UL) && (exec_us > budget_us))
+            {
+                stats.overruns++;
+                skip_next = (budget_action == BNO08xCbBudgetAction::SKIP);
+            }
+        }
+
         uint8_t rpt_ID;
+        BNO08xCbGeneric* volatile next; ///< Next callback in the dispatch list this callback is linked into (nullptr if last).
+        volatile bool registered; ///< True from being linked into a dispatch list until unregistered.
+        bno08x_cb_stats_t stats; ///< Execution statistics, written by the task executing the callback.
+        // settings in use, only written by the dispatcher (see cfg_apply())
+        uint32_t budget_us;      ///< Execution time budget in microseconds, 0 if unlimited.
+        BNO08xCbBudgetAction budget_action; ///< Action taken when budget_us is exceeded.
+        bool skip_next;                     ///< True if the next invocation is skipped due to an overrun.
+        uint32_t decimation;       ///< Callback is invoked once every decimation samples, 1 to invoke on every sample.
+        uint32_t target_period_us; ///< If non 0, decimation is derived from the triggering report's period instead.
+        BNO08xDecimationMode decimation_mode; ///< Sample passed to the callback when decimated.
+        uint32_t decimation_cnt;              ///< Samples received since the callback was last invoked.
+        cfg_t cfg_pending;                    ///< Settings to apply, only written between cfg_begin() and cfg_commit().
 
     protected:
+        /**
+         * @brief Folds a sample into the mean passed to the callback when BNO08xDecimationMode::AVERAGE is used.
+         *
+         * @param rpt_data Pointer to the report sample just received.
+         * @param n Amount of samples in the mean including rpt_data.
+         *
+         * @return Pointer to the mean, rpt_data itself for callbacks that are not passed samples.
+         */
+        virtual const void* accumulate(const void* rpt_data, uint32_t n)
+        {
+            return rpt_data;
+        }
+
+        /**
+         * @brief Applies a committed cfg_pending to the settings used by dispatch(), such that the dispatcher is the
+         * only writer of the settings and counters it reads.
+         *
+         * @return void, nothing to return
+         */
+        void cfg_apply()
+        {
+            const uint32_t seq = __atomic_load_n(&cfg_seq, __ATOMIC_RELAXED);
+            cfg_t cfg;
+
+            if ((seq == cfg_applied_seq) || (seq & 1UL))
+                return;
+
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            cfg = cfg_pending;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+            // a setter began another update while copying, it is applied on the next invocation instead
+            if (__atomic_load_n(&cfg_seq, __ATOMIC_RELAXED) != seq)
+                return;
+
+            budget_us = cfg.budget_us;
+            budget_action = cfg.budget_action;
+            skip_next = false;
+            decimation = cfg.decimation;
+            target_period_us = cfg.target_period_us;
+            decimation_mode = cfg.decimation_mode;
+            decimation_cnt = 0UL;
+            cfg_applied_seq = seq;
+        }
+
         BNO08xCbGeneric(uint8_t rpt_ID)
             : rpt_ID(rpt_ID)
+            , next(nullptr)
+            , registered(false)
+            , budget_us(0UL)
+            , budget_action(BNO08xCbBudgetAction::FLAG)
+            , skip_next(false)
+            , decimation(1UL)
+            , target_period_us(0UL)
+            , decimation_mode(BNO08xDecimationMode::LATEST)
+            , decimation_cnt(0UL)
+            , cfg_seq(0UL)
+            , cfg_applied_seq(0UL)
         {
         }
-};
\ No newline at end of file
+
+    private:
+        uint32_t cfg_seq;         ///< Incremented by cfg_begin() and cfg_commit(), even once cfg_pending is complete.
+        uint32_t cfg_applied_seq; ///< cfg_seq of the cfg_pending last applied by dispatch().
+};
@@ -0,0 +1,131 @@
+/**
+ * @file BNO08xCbInplaceFunction.hpp
+ * @author Myles Parfeniuk
+ */
+
+#pragma once
+
+// standard library includes
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <type_traits>
+// esp-idf includes
+#include "sdkconfig.h"
+
+template <typename TSig, size_t Capacity>
+class BNO08xCbInplaceFunction;
+
+/**
+ * @class BNO08xCbInplaceFunction
+ *
+ * @brief Fixed capacity replacement for std::function used to store callbacks.
+ *
+ * Callables are copied into inline storage of Capacity bytes such that registering a callback never
+ * allocates on the heap, callables which do not fit are rejected at compile time.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class BNO08xCbInplaceFunction<R(Args...), Capacity>
+{
+    public:
+        BNO08xCbInplaceFunction()
+            : invoke_fxn(nullptr)
+            , manage_fxn(nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructs from any callable invocable with the signature R(Args...).
+         *
+         * @param fxn Callable to copy into inline storage.
+         */
+        template <typename F, typename TFxn = std::decay_t<F>,
+                typename = std::enable_if_t<!std::is_same_v<TFxn, BNO08xCbInplaceFunction> &&
+                                            std::is_invocable_r_v<R, TFxn&, Args...>>>
+        BNO08xCbInplaceFunction(F&& fxn)
+        {
+            static_assert(sizeof(TFxn) <= Capacity,
+                    "Callback is too large for inline callback storage, capture less state or increase "
+                    "CONFIG_ESP32_BNO08X_CB_INPLACE_SZ (menuconfig->esp32_BNO08x->Callbacks).");
+            static_assert(alignof(TFxn) <= STORAGE_ALIGN, "Callback alignment exceeds inline callback storage alignment.");
+
+            new (storage) TFxn(std::forward<F>(fxn));
+
+            invoke_fxn = [](void* obj, Args... args) -> R { return (*static_cast<TFxn*>(obj))(std::forward<Args>(args)...); };
+
+            manage_fxn = [](void* dest, const void* src)
+            {
+                if (src != nullptr)
+                    new (dest) TFxn(*static_cast<const TFxn*>(src));
+                else
+                    static_cast<TFxn*>(dest)->~TFxn();
+            };
+        }
+
+        BNO08xCbInplaceFunction(const BNO08xCbInplaceFunction& other)
+            : invoke_fxn(other.invoke_fxn)
+            , manage_fxn(other.manage_fxn)
+        {
+            if (manage_fxn != nullptr)
+                manage_fxn(storage, other.storage);
+        }
+
+        BNO08xCbInplaceFunction& operator=(const BNO08xCbInplaceFunction& other)
+        {
+            if (this != &other)
+            {
+                reset();
+                invoke_fxn = other.invoke_fxn;
+                manage_fxn = other.manage_fxn;
+
+                if (manage_fxn != nullptr)
+                    manage_fxn(storage, other.storage);
+            }
+
+            return *this;
+        }
+
+        ~BNO08xCbInplaceFunction()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Invokes contained callable, must not be called on an empty object.
+         */
+        R operator()(Args... args) const
+        {
+            return invoke_fxn(storage, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return (invoke_fxn != nullptr);
+        }
+
+    private:
+        static const constexpr size_t STORAGE_ALIGN = alignof(max_align_t);
+
+        /**
+         * @brief Destroys contained callable (if any), leaving the object empty.
+         *
+         * @return void, nothing to return
+         */
+        void reset()
+        {
+            if (manage_fxn != nullptr)
+                manage_fxn(storage, nullptr);
+
+            invoke_fxn = nullptr;
+            manage_fxn = nullptr;
+        }
+
+        alignas(STORAGE_ALIGN) mutable uint8_t storage[Capacity]; ///< Inline storage for the contained callable.
+        R (*invoke_fxn)(void*, Args...);                         ///< Calls the contained callable.
+        void (*manage_fxn)(void*, const void*); ///< Copies contained callable into dest if src is non-null, destroys it otherwise.
+};
+
+/// @brief Callback storage type used for all user registered callbacks, see CONFIG_ESP32_BNO08X_CB_INPLACE_SZ.
+template <typename TSig>
+using BNO08xCbFunction = BNO08xCbInplaceFunction<TSig, CONFIG_ESP32_BNO08X_CB_INPLACE_SZ>;
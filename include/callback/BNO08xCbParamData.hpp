@@ -0,0 +1,70 @@
+/**
+ * @file BNO08xCbParamData.hpp
+ * @author Myles Parfeniuk
+ */
+
+#pragma once
+
+#include "BNO08xCbGeneric.hpp"
+
+/// @brief Storage for type erased data callbacks, large enough to hold a wrapper capturing one BNO08xCbFunction.
+using BNO08xCbDataFunction = BNO08xCbInplaceFunction<void(const void*), sizeof(BNO08xCbFunction<void(const void*)>)>;
+
+/// @brief Type erased bno08x_sample_mean() of the report's sample type.
+using BNO08xCbMeanFunction = void (*)(void* mean, const void* sample, uint32_t n);
+
+/**
+ * @class BNO08xCbParamData
+ *
+ * @brief Class to hold callback functions which are passed the report sample that triggered them.
+ *
+ * The contained function receives a type erased pointer to the sample, the typed register_cb()
+ * overloads of each report wrap the user's callback to cast it back to the report's data type.
+ */
+class BNO08xCbParamData : public BNO08xCbGeneric
+{
+    public:
+        BNO08xCbParamData(BNO08xCbDataFunction cb_fxn, uint8_t rpt_ID, BNO08xCbMeanFunction mean_fxn = nullptr)
+            : BNO08xCbGeneric(rpt_ID)
+            , cb_fxn(cb_fxn)
+            , mean_fxn(mean_fxn)
+        {
+        }
+
+        /**
+         * @brief Invokes contained callback function.
+         *
+         * @param rpt_ID n/a, not used, kept to maintain same prototype as
+         * BNO08xCbParamRptID::invoke()
+         * @param rpt_data Pointer to the report sample to be passed to contained callback.
+         *
+         * @return void, nothing to return
+         */
+        void invoke(uint8_t rpt_ID, const void* rpt_data) override
+        {
+            cb_fxn(rpt_data);
+        }
+
+    protected:
+        /**
+         * @brief Folds a sample into the mean passed to the callback when decimated with BNO08xDecimationMode::AVERAGE.
+         *
+         * @param rpt_data Pointer to the report sample just received.
+         * @param n Amount of samples in the mean including rpt_data.
+         *
+         * @return Pointer to the mean, rpt_data itself if the sample type has no mean function.
+         */
+        const void* accumulate(const void* rpt_data, uint32_t n) override
+        {
+            if (mean_fxn == nullptr)
+                return rpt_data;
+
+            mean_fxn(mean, rpt_data, n);
+            return mean;
+        }
+
+    private:
+        BNO08xCbDataFunction cb_fxn;   ///< Wrapped callback function passed at register_cb().
+        BNO08xCbMeanFunction mean_fxn; ///< Mean function of the report's sample type.
+        alignas(8) uint8_t mean[BNO08X_SAMPLE_MAX_SZ]; ///< Running mean of samples since the callback was last invoked.
+};
@@ -15,7 +15,7 @@
 class BNO08xCbParamRptID : public BNO08xCbGeneric
 {
     public:
-        BNO08xCbParamRptID(std::function<void(uint8_t)> cb_fxn, uint8_t rpt_ID)
+        BNO08xCbParamRptID(BNO08xCbFunction<void(uint8_t)> cb_fxn, uint8_t rpt_ID)
             : BNO08xCbGeneric(rpt_ID)
             , cb_fxn(cb_fxn)
 
@@ -26,14 +26,16 @@ class BNO08xCbParamRptID : public BNO08xCbGeneric
          * @brief Invokes contained callback function.
          *
          * @param rpt_ID Report ID to be passed to contained callback.
+         * @param rpt_data n/a, not used, kept to maintain same prototype as
+         * BNO08xCbParamData::invoke()
          *
          * @return void, nothing to return
          */
-        void invoke(uint8_t rpt_ID) override
+        void invoke(uint8_t rpt_ID, const void* rpt_data) override
         {
             cb_fxn(rpt_ID);
         }
 
     private:
-        std::function<void(uint8_t)> cb_fxn; ///< Wrapped callback function passed at register_cb().
+        BNO08xCbFunction<void(uint8_t)> cb_fxn; ///< Wrapped callback function passed at register_cb().
 };
@@ -15,7 +15,7 @@
 class BNO08xCbParamVoid : public BNO08xCbGeneric
 {
     public:
-        BNO08xCbParamVoid(std::function<void(void)> cb_fxn, uint8_t rpt_ID)
+        BNO08xCbParamVoid(BNO08xCbFunction<void(void)> cb_fxn, uint8_t rpt_ID)
             : BNO08xCbGeneric(rpt_ID)
             , cb_fxn(cb_fxn)
         {
@@ -26,14 +26,16 @@ class BNO08xCbParamVoid : public BNO08xCbGeneric
          *
          * @param rpt_ID n/a, not used, kept to maintain same prototype as
          * BNO08xCbParamRptID::invoke()
+         * @param rpt_data n/a, not used, kept to maintain same prototype as
+         * BNO08xCbParamData::invoke()
          *
          * @return void, nothing to return
          */
-        void invoke(uint8_t rpt_ID) override
+        void invoke(uint8_t rpt_ID, const void* rpt_data) override
         {
             cb_fxn();
         }
 
     private:
-        std::function<void(void)> cb_fxn; ///< Wrapped callback function passed at register_cb().
+        BNO08xCbFunction<void(void)> cb_fxn; ///< Wrapped callback function passed at register_cb().
 };
@@ -5,10 +5,11 @@
 
 #pragma once
 
-// standard library includes
-#include <functional>
 // esp-idf includes
 #include "esp_log.h"
+// etl includes
+#include <etl/span.h>
+#include <etl/queue.h>
 // in-house includes
 #include "BNO08xGlobalTypes.hpp"
 #include "BNO08xPrivateTypes.hpp"
@@ -17,6 +18,8 @@
 #include "sh2_SensorValue.h"
 #include "sh2_err.h"
 
+class BNO08xFrameBase;
+
 /**
  * @class BNO08xRpt
  *
@@ -26,12 +29,22 @@ class BNO08xRpt
 {
     public:
         bool disable(sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg);
-        bool register_cb(std::function<void(void)> cb_fxn);
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(void)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
         bool has_new_data();
         bool flush();
         bool get_sample_counts(bno08x_sample_counts_t& sample_counts);
         bool clear_sample_counts();
         bool get_meta_data(bno08x_meta_data_t& meta_data);
+        void set_overload_policy(BNO08xOverloadPolicy policy);
+        BNO08xOverloadPolicy get_overload_policy();
+        bno08x_rpt_drop_stats_t get_drop_stats();
+        void clear_drop_stats();
+        EventBits_t get_rpt_bit();
+        bool set_lane(BNO08xLane lane);
+        BNO08xLane get_lane();
+        bool set_cb_worker(uint8_t worker);
+        uint8_t get_cb_worker();
+        void disable_history();
         virtual bool enable(
                 uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg) = 0;
 
@@ -40,8 +53,31 @@ class BNO08xRpt
         EventBits_t rpt_bit; ///< Respective enable and data bit for report in evt_grp_rpt_en and evt_grp_rpt_data
         uint32_t period_us;  ///< The period/interval of the report in microseconds.
         BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx;
+        BNO08xCbGeneric* volatile cb_list_head; ///< Dispatch list of callbacks registered to this report (linked through cb_list).
+        BNO08xCbGeneric* volatile cb_list_inline_head; ///< Dispatch list of BNO08xCbExec::INLINE callbacks registered to this report.
+        BNO08xOverloadPolicy overload_policy; ///< Action taken when the callback queue is full.
+        BNO08xLane lane;                      ///< Processing lane, selects sensor event queue, task and callback queue.
+        const bool continuous;                ///< True if the hub sends the report every period, false if it only reports on events.
+        uint8_t cb_worker;                    ///< Index of the callback worker that executes this report's callbacks.
+        bno08x_rpt_drop_stats_t drop_stats;   ///< Counts of samples lost for this report, incremented with drop_stat_inc() by either lane's data_proc_task().
+        uint32_t seq; ///< Amount of samples received for this report, only written by data_proc_task(), read by BNO08xSubscriber.
+        uint64_t timestamp_us; ///< Sensor timestamp of the most recent sample, set by BNO08x::handle_sensor_report().
+        uint32_t sample_seq; ///< Hub sequence number of the most recent sample extended to 32 bits, set by BNO08x::handle_sensor_report().
+        uint8_t hub_seq;     ///< 8 bit sequence number of the most recent sample as sent by the hub.
+        volatile bool seq_resync; ///< Set by rpt_enable(), the next sample adopts the hub's sequence number without counting a gap.
+        uint8_t proc_dispatcher; ///< Inline dispatcher index of the data_proc_task() processing the most recent sample, set by BNO08x::handle_sensor_report().
+        uint8_t* history_buf;  ///< User provided history storage (array of bno08x_history_entry_t), nullptr if disabled.
+        size_t history_depth;  ///< Capacity of history_buf in entries.
+        size_t history_head;   ///< Index in history_buf the next sample is written to.
+        uint32_t history_seq;  ///< Amount of samples written to history_buf since it was enabled.
+        BNO08xFrameBase* frame; ///< Frame this report is a member of, nullptr if none.
+        void* frame_slot;       ///< Pending sample slot of this report within frame.
+        volatile uint8_t next_waiter_cnt; ///< Amount of tasks blocked in get_next() on this report, written with user data locked.
 
-        bool rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg);
+        bool rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg,
+                bool await_ack = true);
+        bool rpt_disable(sh2_SensorConfig_t sensor_cfg, bool await_ack);
+        virtual void apply_required_cfg(sh2_SensorConfig_t& sensor_cfg);
         virtual void update_data(sh2_SensorValue_t* sensor_val) = 0;
 
         /**
@@ -53,15 +89,36 @@ class BNO08xRpt
          * @param report_ID Report ID, ex. SH2_ACCELERATION.
          *  @param rpt_bit Respective enable bit for report in BNO08x::evt_grp_report_en.
          *  @param period_us The period/interval of the report in microseconds.
+         * @param lane Default processing lane of the report.
+         * @param continuous False for detector and classifier reports, which only report on events.
          *
          * @return void, nothing to return
          */
-        BNO08xRpt(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
+        BNO08xRpt(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx,
+                BNO08xLane lane = BNO08xLane::HIGH, bool continuous = true)
             : ID(ID)
             , rpt_bit(rpt_bit)
             , period_us(0UL)
             , sync_ctx(sync_ctx)
-
+            , cb_list_head(nullptr)
+            , cb_list_inline_head(nullptr)
+            , overload_policy(BNO08xOverloadPolicy::DROP_NEWEST)
+            , lane(lane)
+            , continuous(continuous)
+            , cb_worker(0U)
+            , seq(0UL)
+            , timestamp_us(0ULL)
+            , sample_seq(0UL)
+            , hub_seq(0U)
+            , seq_resync(true)
+            , proc_dispatcher(BNO08xPrivateTypes::cb_dispatcher_inline(lane))
+            , history_buf(nullptr)
+            , history_depth(0U)
+            , history_head(0U)
+            , history_seq(0UL)
+            , frame(nullptr)
+            , frame_slot(nullptr)
+            , next_waiter_cnt(0U)
         {
         }
 
@@ -71,10 +128,337 @@ class BNO08xRpt
         void lock_user_data();
         void signal_data_available();
 
+        /**
+         * @brief Stamps a sample with the timestamp and sequence number of the sensor event it was decoded from.
+         *
+         * Called from update_data() with user data locked.
+         *
+         * @param sample The sample to stamp.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void stamp_sample(T& sample)
+        {
+            sample.timestamp_us = timestamp_us;
+            sample.seq = sample_seq;
+        }
+
+        /**
+         * @brief Stamps a raw MEMS sample, which keeps the raw sensor timestamp in timestamp_us, the sensor event's
+         * timestamp is stored to hub_timestamp_us instead.
+         *
+         * Called from update_data() with user data locked.
+         *
+         * @param sample The sample to stamp.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void stamp_raw_sample(T& sample)
+        {
+            sample.hub_timestamp_us = timestamp_us;
+            sample.seq = sample_seq;
+        }
+        void signal_cb(const void* rpt_data, size_t rpt_data_sz);
+        void send_cb_evt(uint8_t worker_idx, const BNO08xPrivateTypes::bno08x_cb_evt_t& cb_evt);
+        void invoke_inline_cbs(const void* rpt_data, uint8_t dispatcher);
+        void frame_updated();
+        bool wait_cfg_ack();
+        BNO08xPrivateTypes::bno08x_next_waiter_t* next_waiter_claim(void* entry);
+        bool next_waiter_release(BNO08xPrivateTypes::bno08x_next_waiter_t* waiter);
+
+        /**
+         * @brief Signals that a new report has arrived and forwards the sample to any registered callbacks.
+         *
+         * @param sample The report sample just received, copied into the callback event sent to cb_task().
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void signal_data_available(const T& sample)
+        {
+            static_assert(sizeof(T) <= BNO08xPrivateTypes::RPT_DATA_MAX_SZ, "Report sample too large for callback event.");
+
+            if (history_buf != nullptr)
+                history_record(sample);
+
+            if (frame != nullptr)
+                frame_record(sample);
+
+            if (next_waiter_cnt != 0U)
+                next_record(sample);
+
+            signal_data_available();
+
+            if ((cb_list_inline_head != nullptr) || (sync_ctx->cb_list_inline_head != nullptr))
+                invoke_inline_cbs(&sample, proc_dispatcher);
+
+            signal_cb(&sample, sizeof(T));
+        }
+
+        /**
+         * @brief Writes a sample to this report's slot in the frame it is a member of.
+         *
+         * @param sample The report sample just received.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void frame_record(const T& sample)
+        {
+            lock_user_data();
+            // re-check under lock, frame may have been disabled
+            if (frame != nullptr)
+            {
+                bno08x_history_entry_t<T>* slot = static_cast<bno08x_history_entry_t<T>*>(frame_slot);
+
+                slot->timestamp_us = timestamp_us;
+                slot->data = sample;
+                frame_updated();
+            }
+            unlock_user_data();
+        }
+
+        /**
+         * @brief Hands a sample to every task blocked in get_next() on this report and wakes them.
+         *
+         * Waiters are woken after user data is unlocked, such that they never block on it right after waking.
+         *
+         * @param sample The report sample just received.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void next_record(const T& sample)
+        {
+            SemaphoreHandle_t sem_wake[CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX];
+            size_t wake_cnt = 0U;
+
+            lock_user_data();
+            for (BNO08xPrivateTypes::bno08x_next_waiter_t& waiter : sync_ctx->next_waiters)
+            {
+                if (waiter.rpt != this)
+                    continue;
+
+                bno08x_history_entry_t<T>* entry = static_cast<bno08x_history_entry_t<T>*>(waiter.entry);
+
+                entry->timestamp_us = timestamp_us;
+                entry->data = sample;
+                waiter.rpt = nullptr;
+                waiter.delivered = true;
+                next_waiter_cnt--;
+                sem_wake[wake_cnt++] = waiter.sem_delivered;
+            }
+            unlock_user_data();
+
+            for (size_t i = 0; i < wake_cnt; i++)
+                xSemaphoreGive(sem_wake[i]);
+        }
+
+        /**
+         * @brief Blocks the calling task until the next sample of this report is received.
+         *
+         * The task is only woken by this report, samples of other reports and other consumers do not affect it.
+         *
+         * @param sample Struct to store the sample and its timestamp.
+         * @param timeout_ms Max time to wait in milliseconds.
+         *
+         * @return True if a sample was received, false if timeout_ms elapsed first or too many tasks are waiting.
+         */
+        template <typename T>
+        bool next_sample(bno08x_history_entry_t<T>& sample, uint32_t timeout_ms)
+        {
+            TimeOut_t timeout;
+            TickType_t ticks_remaining = timeout_ms / portTICK_PERIOD_MS;
+            BNO08xPrivateTypes::bno08x_next_waiter_t* waiter = next_waiter_claim(&sample);
+
+            if (waiter == nullptr)
+                return false;
+
+            vTaskSetTimeOutState(&timeout);
+
+            // a give meant for the waiter's previous claimant may still arrive, so only delivered ends the wait
+            while (!waiter->delivered)
+            {
+                if (xTaskCheckForTimeOut(&timeout, &ticks_remaining) == pdTRUE)
+                    break;
+
+                xSemaphoreTake(waiter->sem_delivered, ticks_remaining);
+            }
+
+            return next_waiter_release(waiter);
+        }
+
+        /**
+         * @brief Appends a detector event to a report's event queue, must be called with user data locked.
+         *
+         * Events are never overwritten, if the queue is full the new event is dropped and counted.
+         *
+         * @param events The report's event queue.
+         * @param sample The detector sample just received.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void event_push(etl::iqueue<bno08x_event_t<T>>& events, const T& sample)
+        {
+            if (events.full())
+            {
+                BNO08xPrivateTypes::drop_stat_inc(drop_stats.event_queue);
+                return;
+            }
+
+            events.push(bno08x_event_t<T>{timestamp_us, sample});
+        }
+
+        /**
+         * @brief Removes the oldest detector event from a report's event queue.
+         *
+         * @param events The report's event queue.
+         * @param evt Struct to store the popped event.
+         *
+         * @return True if an event was popped, false if the queue was empty.
+         */
+        template <typename T>
+        bool event_pop(etl::iqueue<bno08x_event_t<T>>& events, bno08x_event_t<T>& evt)
+        {
+            bool popped = false;
+
+            lock_user_data();
+            if (!events.empty())
+            {
+                evt = events.front();
+                events.pop();
+                popped = true;
+            }
+            unlock_user_data();
+
+            return popped;
+        }
+
+        /**
+         * @brief Enables recording of every received sample into a user provided ring buffer.
+         *
+         * @param buf Storage for the history, its size is the history depth. Must outlive the report or be released
+         * with disable_history().
+         *
+         * @return True if history was enabled, false if buf is empty.
+         */
+        template <typename T>
+        bool history_enable(etl::span<bno08x_history_entry_t<T>> buf)
+        {
+            if (buf.empty())
+                return false;
+
+            lock_user_data();
+            history_buf = reinterpret_cast<uint8_t*>(buf.data());
+            history_depth = buf.size();
+            history_head = 0U;
+            history_seq = 0UL;
+            unlock_user_data();
+
+            return true;
+        }
+
+        /**
+         * @brief Appends a sample to the history buffer, overwriting the oldest entry if full.
+         *
+         * @param sample The report sample just received.
+         *
+         * @return void, nothing to return
+         */
+        template <typename T>
+        void history_record(const T& sample)
+        {
+            lock_user_data();
+            // re-check under lock, disable_history() may have been called
+            if (history_buf != nullptr)
+            {
+                bno08x_history_entry_t<T>* entries = reinterpret_cast<bno08x_history_entry_t<T>*>(history_buf);
+
+                entries[history_head].timestamp_us = timestamp_us;
+                entries[history_head].data = sample;
+                history_head = (history_head + 1U) % history_depth;
+                history_seq++;
+            }
+            unlock_user_data();
+        }
+
+        /**
+         * @brief Copies every history entry newer than cursor into span under a single data lock.
+         *
+         * If entries older than cursor have been overwritten, copying resumes from the oldest entry still stored.
+         *
+         * @param cursor Sequence number of the next entry to read, start at 0, advanced past the copied entries.
+         * @param span Destination for the copied entries, oldest first.
+         *
+         * @return Amount of entries copied into span.
+         */
+        template <typename T>
+        size_t history_read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<T>> span)
+        {
+            size_t count = 0U;
+            size_t stored = 0U;
+            size_t unread = 0U;
+
+            lock_user_data();
+            if (history_buf != nullptr)
+            {
+                bno08x_history_entry_t<T>* entries = reinterpret_cast<bno08x_history_entry_t<T>*>(history_buf);
+
+                stored = (history_seq < history_depth) ? history_seq : history_depth;
+                unread = history_seq - cursor;
+
+                // cursor fell behind (or predates history being re-enabled), skip to oldest stored entry
+                if (unread > stored)
+                    unread = stored;
+
+                count = (unread < span.size()) ? unread : span.size();
+
+                for (size_t i = 0; i < count; i++)
+                    span[i] = entries[(history_head + history_depth - unread + i) % history_depth];
+
+                cursor = history_seq - unread + count;
+            }
+            unlock_user_data();
+
+            return count;
+        }
+
+        /**
+         * @brief Registers a callback which is passed the report sample of type T that triggered it.
+         *
+         * @param cb_fxn Callback function, should be of void return type with single const T& input param.
+         * @param exec Context the callback executes in.
+         *
+         * @return Handle to the callback, used to unregister it, invalid if registration failed.
+         */
+        template <typename T, typename TFxn>
+        bno08x_cb_handle_t register_cb_data(const TFxn& cb_fxn, BNO08xCbExec exec)
+        {
+            return BNO08xPrivateTypes::cb_list_register(*sync_ctx,
+                    (exec == BNO08xCbExec::INLINE) ? cb_list_inline_head : cb_list_head,
+                    BNO08xCbParamData([cb_fxn](const void* rpt_data) { cb_fxn(*static_cast<const T*>(rpt_data)); }, ID,
+                            [](void* mean, const void* sample, uint32_t n)
+                            { bno08x_sample_mean(*static_cast<T*>(mean), *static_cast<const T*>(sample), n); }));
+        }
+
         static const constexpr float RAD_2_DEG =
                 (180.0f / M_PI); ///< Constant for radian to degree conversions, sed in quaternion to euler function conversions.
 
+        static const constexpr size_t EVENT_QUEUE_SZ =
+                CONFIG_ESP32_BNO08X_EVENT_QUEUE_SZ; ///< Capacity of detector/classifier report event queues.
+
+        static const constexpr TickType_t RPT_CFG_ACK_TIMEOUT_TICKS = BNO08xPrivateTypes::ms_to_ticks(
+                CONFIG_ESP32_BNO08X_RPT_CFG_ACK_TIMEOUT_MS); ///< Max wait for the BNO08x to confirm a report's config with a Get Feature Response.
+
+        static const constexpr TickType_t CB_QUEUE_BLOCK_TIMEOUT_TICKS = BNO08xPrivateTypes::ms_to_ticks(
+                CONFIG_ESP32_BNO08X_CB_QUEUE_BLOCK_TIMEOUT_MS); ///< Max wait for callback queue space when overload_policy is BNO08xOverloadPolicy::BLOCK.
+
         static const constexpr char* TAG = "BNO08xRpt";
 
         friend class BNO08x;
+        friend class BNO08xSubscriber;
+        friend class BNO08xFrameBase;
 };
\ No newline at end of file
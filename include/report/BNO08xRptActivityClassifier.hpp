@@ -15,20 +15,30 @@
 class BNO08xRptActivityClassifier : public BNO08xRpt
 {
     public:
+        using sample_t = bno08x_activity_classifier_t; ///< Type of sample passed to callbacks, history and frames.
+
         BNO08xRptActivityClassifier(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
-            : BNO08xRpt(ID, rpt_bit, sync_ctx)
+            : BNO08xRpt(ID, rpt_bit, sync_ctx, BNO08xLane::LOW, false)
         {
         }
 
         bool enable(
                 uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg) override;
+        using BNO08xRpt::register_cb;
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(const bno08x_activity_classifier_t& data)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool enable_history(etl::span<bno08x_history_entry_t<bno08x_activity_classifier_t>> buf);
+        size_t read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_activity_classifier_t>> span);
+        bool get_next(bno08x_history_entry_t<bno08x_activity_classifier_t>& sample, uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+        bool pop_event(bno08x_event_t<bno08x_activity_classifier_t>& evt);
         bno08x_activity_classifier_t get();
         BNO08xActivity get_most_likely_activity();
         void set_activities_to_enable(BNO08xActivityEnable activities_to_enable);
 
     private:
         void update_data(sh2_SensorValue_t* sensor_val) override;
+        void apply_required_cfg(sh2_SensorConfig_t& sensor_cfg) override;
         bno08x_activity_classifier_t data; ///< Most recent report data, doesn't account for step rollover.
+        etl::queue<bno08x_event_t<bno08x_activity_classifier_t>, EVENT_QUEUE_SZ> events; ///< Events not yet popped.
         BNO08xActivityEnable activities_to_enable =
                 BNO08xActivityEnable::ALL; ///< Activities to be monitored, call enable after setting.
         static const constexpr char* TAG = "BNO08xRptActivityClassifier";
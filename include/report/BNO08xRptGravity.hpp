@@ -15,6 +15,8 @@
 class BNO08xRptGravity : public BNO08xRpt
 {
     public:
+        using sample_t = bno08x_accel_t; ///< Type of sample passed to callbacks, history and frames.
+
         BNO08xRptGravity(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
             : BNO08xRpt(ID, rpt_bit, sync_ctx)
         {
@@ -22,6 +24,11 @@ class BNO08xRptGravity : public BNO08xRpt
 
         bool enable(
                 uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg) override;
+        using BNO08xRpt::register_cb;
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(const bno08x_accel_t& data)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool enable_history(etl::span<bno08x_history_entry_t<bno08x_accel_t>> buf);
+        size_t read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_accel_t>> span);
+        bool get_next(bno08x_history_entry_t<bno08x_accel_t>& sample, uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
         bno08x_accel_t get();
 
     private:
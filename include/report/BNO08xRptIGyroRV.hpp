@@ -15,6 +15,8 @@
 class BNO08xRptIGyroRV : public BNO08xRptRVGeneric
 {
     public:
+        using sample_t = etl::pair<bno08x_quat_t, bno08x_ang_vel_t>; ///< Type of sample passed to callbacks, history and frames.
+
         BNO08xRptIGyroRV(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
             : BNO08xRptRVGeneric(ID, rpt_bit, sync_ctx)
         {
@@ -22,6 +24,11 @@ class BNO08xRptIGyroRV : public BNO08xRptRVGeneric
 
         void get(bno08x_quat_t& quat, bno08x_ang_vel_t& vel);
         bno08x_ang_vel_t get_vel();
+        using BNO08xRpt::register_cb;
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(const bno08x_quat_t& quat, const bno08x_ang_vel_t& vel)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool enable_history(etl::span<bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>> buf);
+        size_t read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>> span);
+        bool get_next(bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>& sample, uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
 
     private:
         void update_data(sh2_SensorValue_t* sensor_val) override;
@@ -15,19 +15,28 @@
 class BNO08xRptStepCounter : public BNO08xRpt
 {
     public:
+        using sample_t = bno08x_step_counter_t; ///< Type of sample passed to callbacks, history and frames.
+
         BNO08xRptStepCounter(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
-            : BNO08xRpt(ID, rpt_bit, sync_ctx)
+            : BNO08xRpt(ID, rpt_bit, sync_ctx, BNO08xLane::LOW, false)
         {
         }
 
         bool enable(
                 uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg) override;
+        using BNO08xRpt::register_cb;
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(const bno08x_step_counter_t& data)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool enable_history(etl::span<bno08x_history_entry_t<bno08x_step_counter_t>> buf);
+        size_t read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_step_counter_t>> span);
+        bool get_next(bno08x_history_entry_t<bno08x_step_counter_t>& sample, uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
+        bool pop_event(bno08x_event_t<bno08x_step_counter_t>& evt);
         bno08x_step_counter_t get();
         uint32_t get_total_steps();
 
     private:
         void update_data(sh2_SensorValue_t* sensor_val) override;
         bno08x_step_counter_t data; ///< Most recent report data, doesn't account for step rollover.
+        etl::queue<bno08x_event_t<bno08x_step_counter_t>, EVENT_QUEUE_SZ> events; ///< Events not yet popped.
         uint32_t step_accumulator =
                 0UL; ///< Every time step count rolls over, the previous steps are accumulated here such that the total steps can always be calculated.
         static const constexpr char* TAG = "BNO08xRptStepCounter";
@@ -16,6 +16,8 @@
 class BNO08xRptUncalMagnetometer : public BNO08xRpt
 {
     public:
+        using sample_t = etl::pair<bno08x_magf_t, bno08x_magf_bias_t>; ///< Type of sample passed to callbacks, history and frames.
+
         BNO08xRptUncalMagnetometer(uint8_t ID, EventBits_t rpt_bit, BNO08xPrivateTypes::bno08x_sync_ctx_t* sync_ctx)
             : BNO08xRpt(ID, rpt_bit, sync_ctx)
         {
@@ -23,6 +25,11 @@ class BNO08xRptUncalMagnetometer : public BNO08xRpt
 
         bool enable(
                 uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg = BNO08xPrivateTypes::default_sensor_cfg) override;
+        using BNO08xRpt::register_cb;
+        bno08x_cb_handle_t register_cb(BNO08xCbFunction<void(const bno08x_magf_t& magf, const bno08x_magf_bias_t& bias)> cb_fxn, BNO08xCbExec exec = BNO08xCbExec::DEFERRED);
+        bool enable_history(etl::span<bno08x_history_entry_t<etl::pair<bno08x_magf_t, bno08x_magf_bias_t>>> buf);
+        size_t read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<etl::pair<bno08x_magf_t, bno08x_magf_bias_t>>> span);
+        bool get_next(bno08x_history_entry_t<etl::pair<bno08x_magf_t, bno08x_magf_bias_t>>& sample, uint32_t timeout_ms = CONFIG_ESP32_BNO08X_DATA_AVAILABLE_TIMEOUT_MS);
         void get(bno08x_magf_t& magf, bno08x_magf_bias_t& bias);
         bno08x_magf_t get_magf();
         bno08x_magf_bias_t get_bias();
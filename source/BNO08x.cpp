@@ -15,18 +15,53 @@ using namespace BNO08xPrivateTypes;
  *
  * @param imu_config Configuration settings (optional), default settings can be seen in
  * bno08x_config_t
+ * @param allocator Allocator all driver storage is obtained from (optional), BNO08xHeapAllocator::default_allocator()
+ * if nullptr. Must outlive the driver object.
  * @return void, nothing to return
  */
-BNO08x::BNO08x(bno08x_config_t imu_config)
+BNO08x::BNO08x(bno08x_config_t imu_config, BNO08xAllocator* allocator)
     : rpt(bno08x_reports_t(&sync_ctx))
     , data_proc_task_hdl(NULL)
+    , data_proc_low_task_hdl(NULL)
     , sh2_HAL_service_task_hdl(NULL)
-    , cb_task_hdl(NULL)
+    , cb_task_hdl{}
     , sem_kill_tasks(NULL)
-    , queue_rx_sensor_event(xQueueCreate(10, sizeof(sh2_SensorEvent_t)))
-    , queue_cb_report_id(xQueueCreate(CONFIG_ESP32_BNO08X_CB_QUEUE_SZ, sizeof(uint8_t)))
+    , mem(allocator)
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    , queue_rx_sensor_event(xQueueCreateStatic(RX_SENSOR_EVENT_QUEUE_SZ, sizeof(sh2_SensorEvent_t), queue_rx_sensor_event_storage,
+              &queue_rx_sensor_event_buffer))
+    , queue_rx_sensor_event_low(xQueueCreateStatic(RX_SENSOR_EVENT_LOW_QUEUE_SZ, sizeof(sh2_SensorEvent_t),
+              queue_rx_sensor_event_low_storage, &queue_rx_sensor_event_low_buffer))
+    #else
+    , queue_rx_sensor_event(mem.create_queue(RX_SENSOR_EVENT_QUEUE_SZ, sizeof(sh2_SensorEvent_t), BNO08xMemRegion::HOT))
+    , queue_rx_sensor_event_low(mem.create_queue(RX_SENSOR_EVENT_LOW_QUEUE_SZ, sizeof(sh2_SensorEvent_t), BNO08xMemRegion::HOT))
+    #endif
+    // clang-format on
     , imu_config(imu_config)
+    , sync_ctx(mem)
+    , kernel_objs_created(false)
 {
+    // created with the other kernel objects such that tearing the tasks down never has to allocate, room for every
+    // task such that it is reused if the tasks are relaunched
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    sem_kill_tasks = xSemaphoreCreateCountingStatic(TASK_COUNT, 0, &sem_kill_tasks_buffer);
+    #else
+    sem_kill_tasks = mem.create_counting_semaphore(TASK_COUNT, 0);
+    #endif
+    // clang-format on
+
+    // the allocator may run out of memory, initialize() fails instead of using NULL handles
+    kernel_objs_created = (queue_rx_sensor_event != NULL) && (queue_rx_sensor_event_low != NULL) &&
+                          (sem_kill_tasks != NULL) && sync_ctx.created();
+
+    // clang-format off
+    #ifndef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    // a kernel object added without updating MEM_ALLOCS_CONSTRUCTION would eat into the allocations of tasks and users
+    configASSERT(!kernel_objs_created || (mem.allocs.size() == MEM_ALLOCS_CONSTRUCTION));
+    #endif
+    // clang-format on
 }
 
 /**
@@ -53,20 +88,52 @@ BNO08x::~BNO08x()
     // deinitialize GPIO if they have been initialized
     ESP_ERROR_CHECK(deinit_gpio());
 
-    // delete all semaphores
-    vSemaphoreDelete(sync_ctx.sh2_HAL_lock);
-    vSemaphoreDelete(sync_ctx.data_lock);
+    // delete all semaphores, any of them may be NULL if the allocator ran out of memory during construction
+    if (sync_ctx.sh2_HAL_lock != NULL)
+        vSemaphoreDelete(sync_ctx.sh2_HAL_lock);
+    if (sync_ctx.data_lock != NULL)
+        vSemaphoreDelete(sync_ctx.data_lock);
+    if (sync_ctx.cb_list_lock != NULL)
+        vSemaphoreDelete(sync_ctx.cb_list_lock);
+    if (sync_ctx.hint_route.sem_hint != NULL)
+        vSemaphoreDelete(sync_ctx.hint_route.sem_hint);
+    for (bno08x_next_waiter_t& waiter : sync_ctx.next_waiters)
+        if (waiter.sem_delivered != NULL)
+            vSemaphoreDelete(waiter.sem_delivered);
+    for (bno08x_cb_worker_t& worker : sync_ctx.cb_workers)
+        if (worker.sem_cb_evt != NULL)
+            vSemaphoreDelete(worker.sem_cb_evt);
     if (sem_kill_tasks != NULL)
         vSemaphoreDelete(sem_kill_tasks);
+    for (BNO08xSubscriber& subscriber : sync_ctx.subscribers)
+        if (subscriber.sem_wake != NULL)
+            vSemaphoreDelete(subscriber.sem_wake);
 
     // delete event groups
-    vEventGroupDelete(sync_ctx.evt_grp_task);
-    vEventGroupDelete(sync_ctx.evt_grp_rpt_en);
-    vEventGroupDelete(sync_ctx.evt_grp_rpt_data_available);
+    if (sync_ctx.evt_grp_task != NULL)
+        vEventGroupDelete(sync_ctx.evt_grp_task);
+    if (sync_ctx.evt_grp_rpt_cfg_ack != NULL)
+        vEventGroupDelete(sync_ctx.evt_grp_rpt_cfg_ack);
+    if (sync_ctx.evt_grp_rpt_en != NULL)
+        vEventGroupDelete(sync_ctx.evt_grp_rpt_en);
+    if (sync_ctx.evt_grp_rpt_data_available != NULL)
+        vEventGroupDelete(sync_ctx.evt_grp_rpt_data_available);
 
     // delete all queues
-    vQueueDelete(queue_rx_sensor_event);
-    vQueueDelete(queue_cb_report_id);
+    if (queue_rx_sensor_event != NULL)
+        vQueueDelete(queue_rx_sensor_event);
+    if (queue_rx_sensor_event_low != NULL)
+        vQueueDelete(queue_rx_sensor_event_low);
+    for (bno08x_cb_worker_t& worker : sync_ctx.cb_workers)
+    {
+        if (worker.queue_cb_evt != NULL)
+            vQueueDelete(worker.queue_cb_evt);
+        if (worker.queue_cb_evt_low != NULL)
+            vQueueDelete(worker.queue_cb_evt_low);
+    }
+
+    // release all storage obtained from the allocator, last as the above objects live within it
+    mem.release_all();
 }
 
 /**
@@ -76,10 +143,22 @@ BNO08x::~BNO08x()
  * Configures GPIO, required ISRs, and launches two tasks, one to manage SPI transactions, another
  * to process any received data.
  *
- * @return True if initialization was success, false if otherwise.
+ * @return True if initialization was success, false if otherwise (including the allocator having run out of memory
+ * while the driver was constructed).
  */
 bool BNO08x::initialize()
 {
+    // kernel objects are created by the constructor, any of them is NULL if the allocator ran out of memory
+    if (!kernel_objs_created)
+    {
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGE(TAG, "Initialization failed, allocator ran out of memory during construction.");
+        #endif
+        // clang-format on
+
+        return false;
+    }
 
     // initialize configuration arguments
     if (init_config_args() != ESP_OK)
@@ -129,18 +208,38 @@ void BNO08x::data_proc_task_trampoline(void* arg)
     imu->data_proc_task();       // launch data processing task task from object
 }
 
+/**
+ * @brief Static function used to launch low lane data processing task.
+ *
+ * Used such that data_proc_task() can be non-static class member.
+ *
+ * @param arg void pointer to BNO08x imu object
+ * @return void, nothing to return
+ */
+void BNO08x::data_proc_low_task_trampoline(void* arg)
+{
+    BNO08x* imu = (BNO08x*) arg;           // cast argument received by xTaskCreate ("this" pointer to imu
+                                           // object created by constructor call)
+    imu->data_proc_task(BNO08xLane::LOW); // launch low lane data processing task from object
+}
+
 /**
  * @brief Task responsible for parsing/handling sensor events sent by SH2 HAL and updating data that
  * is returned to user.
  *
+ * One instance runs per lane such that reports in BNO08xLane::HIGH never wait behind BNO08xLane::LOW traffic.
+ *
+ * @param lane The lane whose sensor event queue this instance processes.
+ *
  * @return void, nothing to return
  */
-void BNO08x::data_proc_task()
+void BNO08x::data_proc_task(BNO08xLane lane)
 {
     EventBits_t evt_grp_bno08x_task_bits = 0U;
     BaseType_t queue_rx_success = pdFALSE;
     sh2_SensorEvent_t sensor_evt;
     sh2_SensorValue_t sensor_val;
+    QueueHandle_t queue_rx = (lane == BNO08xLane::LOW) ? queue_rx_sensor_event_low : queue_rx_sensor_event;
 
     do
     {
@@ -148,16 +247,21 @@ void BNO08x::data_proc_task()
         if (queue_rx_success == pdTRUE)
         {
             if (sh2_decodeSensorEvent(&sensor_val, &sensor_evt) != SH2_ERR)
-                handle_sensor_report(&sensor_val);
+                handle_sensor_report(&sensor_val, lane);
+            else
+                drop_stat_inc(sync_ctx.drop_stats.decode);
         }
 
-        queue_rx_success = xQueueReceive(queue_rx_sensor_event, &sensor_evt, portMAX_DELAY);
+        queue_rx_success = xQueueReceive(queue_rx, &sensor_evt, portMAX_DELAY);
         evt_grp_bno08x_task_bits = xEventGroupGetBits(sync_ctx.evt_grp_task);
 
     } while (evt_grp_bno08x_task_bits & EVT_GRP_BNO08x_TASKS_RUNNING);
 
     xSemaphoreGive(sem_kill_tasks); // signal to deconstructor deletion is completed
-    init_status.data_proc_task = false;
+    if (lane == BNO08xLane::LOW)
+        init_status.data_proc_low_task = false;
+    else
+        init_status.data_proc_task = false;
     vTaskDelete(NULL);
 }
 
@@ -184,7 +288,7 @@ void BNO08x::sh2_HAL_service_task_trampoline(void* arg)
  */
 void BNO08x::sh2_HAL_service_task()
 {
-    EventBits_t evt_grp_bno08x_task_bits = 0U;
+    EventBits_t evt_grp_bno08x_task_bits = xEventGroupGetBits(sync_ctx.evt_grp_task);
 
     // clang-format off
     #ifdef CONFIG_ESP32_BNO08x_DEBUG_STATEMENTS
@@ -196,27 +300,42 @@ void BNO08x::sh2_HAL_service_task()
     do
     {
 
+        if (evt_grp_bno08x_task_bits & EVT_GRP_BNO08x_TASK_SOFT_RESET_REQUESTED)
+        {
+            xEventGroupClearBits(sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASK_SOFT_RESET_REQUESTED);
+
+            // the reset is detected and recovered from like any other, if HINT is still stuck the write escalates to a
+            // hard reset, only counted once the hub actually received it
+            lock_sh2_HAL();
+            if (sh2_devReset() == SH2_OK)
+                sync_ctx.hint_recovery.stats.soft_resets++;
+            unlock_sh2_HAL();
+        }
+
         if (evt_grp_bno08x_task_bits & EVT_GRP_BNO08x_TASK_RESET_OCCURRED)
         {
-            if (re_enable_reports() != ESP_OK)
+            if (recover_from_reset() != ESP_OK)
             {
                 // clang-format off
                 #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-                ESP_LOGE(TAG, "Failed to re-enable enabled reports after IMU reset.");
+                ESP_LOGE(TAG, "Failed to restore report and calibration configs after IMU reset.");
                 #endif
                 // clang-format on
             }
         }
 
-        if (evt_grp_bno08x_task_bits & EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT)
-        {
-            lock_sh2_HAL();
+        // the assertion may have been serviced by another task's transaction while this task waited for the lock
+        lock_sh2_HAL();
+        if (!sync_ctx.hint_route.suspended && sync_ctx.hint_route.asserted())
             sh2_service();
-            unlock_sh2_HAL();
-        }
+        unlock_sh2_HAL();
 
-        evt_grp_bno08x_task_bits = xEventGroupWaitBits(sync_ctx.evt_grp_task,
-                EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT | EVT_GRP_BNO08x_TASK_RESET_OCCURRED, pdFALSE, pdFALSE, portMAX_DELAY);
+        // woken directly by hint_handler(), or by hal_cb() and deinit_tasks() with the reason set in evt_grp_task
+        // parked here while suspended, until resume() notifies it
+        if (sync_ctx.hint_route.suspended || (sync_ctx.hint_route.mode != BNO08xHintMode::BUSY_POLL) ||
+                !poll_for_hint())
+            ulTaskNotifyTakeIndexed(HINT_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+        evt_grp_bno08x_task_bits = xEventGroupGetBits(sync_ctx.evt_grp_task);
 
         // clang-format off
         #ifdef CONFIG_ESP32_BNO08x_DEBUG_STATEMENTS
@@ -238,54 +357,73 @@ void BNO08x::sh2_HAL_service_task()
  *
  * Used such that cb_task() can be non-static class member.
  *
- * @param arg void pointer to BNO08x imu object
+ * @param arg void pointer to the bno08x_cb_worker_t the task serves
  * @return void, nothing to return
  */
 void BNO08x::cb_task_trampoline(void* arg)
 {
-    BNO08x* imu = (BNO08x*) arg; // cast argument received by xTaskCreate ("this" pointer to imu
-                                 // object created by constructor call)
-    imu->cb_task();              // launch data processing task task from object
+    bno08x_cb_worker_t* worker = (bno08x_cb_worker_t*) arg; // cast argument received by xTaskCreate
+    worker->imu->cb_task(*worker);                           // launch callback task from object
 }
 
 /**
  * @brief Task responsible for executing callbacks registered with register_cb().
  *
+ * One instance runs per callback worker. Each report is served by a single worker such that its callbacks
+ * execute in order, reports assigned to different workers execute in parallel. Pending BNO08xLane::HIGH
+ * callback events are always executed before BNO08xLane::LOW callback events.
+ *
+ * @param worker The callback worker whose queues this instance drains.
+ *
  * @return void, nothing to return
  */
-void BNO08x::cb_task()
+void BNO08x::cb_task(bno08x_cb_worker_t& worker)
 {
     EventBits_t evt_grp_bno08x_task_bits = 0U;
-    uint8_t rpt_ID = 0;
+    bno08x_cb_evt_t cb_evt;
+    const uint8_t dispatcher = static_cast<uint8_t>(&worker - sync_ctx.cb_workers);
 
     do
     {
-        // execute callbacks
-        for (auto& cb_entry : sync_ctx.cb_list)
-        {
-            BNO08xCbGeneric* cb_ptr = nullptr;
+        xSemaphoreTake(worker.sem_cb_evt, portMAX_DELAY);
 
-            if (auto* ptr = etl::get_if<BNO08xCbParamVoid>(&cb_entry))
-                cb_ptr = ptr;
-
-            else if (auto* ptr = etl::get_if<BNO08xCbParamRptID>(&cb_entry))
-                cb_ptr = ptr;
-
-            if (cb_ptr != nullptr)
-                handle_cb(rpt_ID, cb_ptr);
+        // execute callbacks, re-checking the high lane before every low lane event
+        while ((xQueueReceive(worker.queue_cb_evt, &cb_evt, 0) == pdTRUE) ||
+                (xQueueReceive(worker.queue_cb_evt_low, &cb_evt, 0) == pdTRUE))
+        {
+            cb_dispatch_begin(sync_ctx, dispatcher);
+            handle_cb(cb_evt);
+            cb_dispatch_end(sync_ctx, dispatcher);
         }
 
-        xQueueReceive(queue_cb_report_id, &rpt_ID, portMAX_DELAY);
-
         evt_grp_bno08x_task_bits = xEventGroupGetBits(sync_ctx.evt_grp_task);
 
     } while (evt_grp_bno08x_task_bits & EVT_GRP_BNO08x_TASKS_RUNNING);
 
-    xSemaphoreGive(sem_kill_tasks); // signal to deconstructor deletion is completed
-    init_status.cb_task = false;
+    xSemaphoreGive(sem_kill_tasks); // signal to deconstructor deletion is completed, init_status.cb_task is
+                                    // cleared by deinit_tasks() such that workers never write it concurrently
     vTaskDelete(NULL);
 }
 
+/**
+ * @brief Core a callback worker is pinned to.
+ *
+ * @param worker_idx Index of the worker in bno08x_sync_ctx_t::cb_workers.
+ *
+ * @return Core of the worker if CONFIG_ESP32_BNO08X_CB_WORKER_ALTERNATE_CORES is enabled, CB_TASK_AFFINITY
+ * otherwise.
+ */
+BaseType_t BNO08x::cb_task_affinity(uint8_t worker_idx)
+{
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_CB_WORKER_ALTERNATE_CORES
+    return static_cast<BaseType_t>(worker_idx % portNUM_PROCESSORS);
+    #else
+    return CB_TASK_AFFINITY;
+    #endif
+    // clang-format on
+}
+
 /**
  * @brief Locks sh2 HAL lib to only allow the calling task to call its APIs.
  *
@@ -294,6 +432,7 @@ void BNO08x::cb_task()
 void BNO08x::lock_sh2_HAL()
 {
     xSemaphoreTake(sync_ctx.sh2_HAL_lock, portMAX_DELAY);
+    sync_ctx.hint_route.claim();
 }
 
 /**
@@ -303,6 +442,7 @@ void BNO08x::lock_sh2_HAL()
  */
 void BNO08x::unlock_sh2_HAL()
 {
+    sync_ctx.hint_route.release();
     xSemaphoreGive(sync_ctx.sh2_HAL_lock);
 }
 
@@ -329,9 +469,12 @@ void BNO08x::unlock_user_data()
 /**
  * @brief Parses receieved report and updates uer data with it.
  *
+ * @param sensor_val The decoded sensor event.
+ * @param lane Lane of the data_proc_task() instance calling, selects the dispatcher slot of inline callbacks.
+ *
  * @return void, nothing to return
  */
-void BNO08x::handle_sensor_report(sh2_SensorValue_t* sensor_val)
+void BNO08x::handle_sensor_report(sh2_SensorValue_t* sensor_val, BNO08xLane lane)
 {
     uint8_t rpt_ID = sensor_val->sensorId;
 
@@ -348,38 +491,58 @@ void BNO08x::handle_sensor_report(sh2_SensorValue_t* sensor_val)
     auto& rpt = usr_reports.at(rpt_ID);
 
     if (rpt == nullptr)
+    {
+        drop_stat_inc(sync_ctx.drop_stats.rpt_disabled);
         return;
+    }
 
-    // send report ids to cb_task for callback execution (only if this report is enabled)
+    // update respective report with new data (only if this report is enabled), report forwards the sample
+    // to cb_task for callback execution
     if (rpt->rpt_bit & xEventGroupGetBits(sync_ctx.evt_grp_rpt_en))
     {
-        // update respective report with new data
+        rpt->timestamp_us = sensor_val->timestamp;
+        // hub sequence numbers are 8 bit and per report, extend them such that gaps remain detectable after rollover
+        if (rpt->seq_resync)
+        {
+            rpt->seq_resync = false;
+            rpt->sample_seq++;
+        }
+        else
+        {
+            rpt->sample_seq += static_cast<uint8_t>(sensor_val->sequence - rpt->hub_seq);
+        }
+        rpt->hub_seq = sensor_val->sequence;
+        rpt->proc_dispatcher = cb_dispatcher_inline(lane);
         rpt->update_data(sensor_val);
-
-        if (sync_ctx.cb_list.size() != 0)
-            if (xQueueSend(queue_cb_report_id, &rpt_ID, 0) != pdTRUE)
-            {
-                // clang-format off
-                #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-                ESP_LOGE(TAG, "Callback queue full, callback execution for report missed.");
-                #endif
-                // clang-format on
-            }
     }
+    else
+        drop_stat_inc(sync_ctx.drop_stats.rpt_disabled);
 }
 
 /**
- * @brief Determines the flavor of a passed callback and executes it appropriately.
+ * @brief Executes callbacks registered to all reports, followed by callbacks registered to the
+ * report which triggered the callback event, as selected by the event's scope.
+ *
+ * Only the dispatch lists interested in the report are walked, data carrying callbacks are passed the
+ * sample contained within the callback event such that user data does not need to be locked. Callbacks registered
+ * to all reports are only ever executed by CB_WORKER_GLOBAL.
+ *
+ * @param cb_evt Callback event received from data_proc_task().
  *
  * @return void, nothing to return
  */
-void BNO08x::handle_cb(uint8_t rpt_ID, BNO08xCbGeneric* cb_entry)
+void BNO08x::handle_cb(const bno08x_cb_evt_t& cb_evt)
 {
-    // only execute callback if it is registered to this report or all reports
-    if ((cb_entry->rpt_ID == 0) || (cb_entry->rpt_ID == rpt_ID))
-    {
-        cb_entry->invoke(rpt_ID);
-    }
+    if (cb_evt.rpt == nullptr)
+        return;
+
+    if (cb_evt.scope & CB_EVT_SCOPE_GLOBAL)
+        for (BNO08xCbGeneric* cb_entry = sync_ctx.cb_list_head; cb_entry != nullptr; cb_entry = cb_entry->next)
+            cb_entry->dispatch(cb_evt.rpt->ID, cb_evt.rpt_data, cb_evt.rpt->period_us);
+
+    if (cb_evt.scope & CB_EVT_SCOPE_RPT)
+        for (BNO08xCbGeneric* cb_entry = cb_evt.rpt->cb_list_head; cb_entry != nullptr; cb_entry = cb_entry->next)
+            cb_entry->dispatch(cb_evt.rpt->ID, cb_evt.rpt_data, cb_evt.rpt->period_us);
 }
 
 /**
@@ -523,11 +686,14 @@ esp_err_t BNO08x::init_gpio_outputs()
 {
     esp_err_t ret = ESP_OK;
 
-    // configure output(s) (CS, RST)
+    // configure output(s) (CS, RST, WAKE)
     gpio_config_t outputs_config;
 
     outputs_config.pin_bit_mask = ((1ULL << imu_config.io_cs) | (1ULL << imu_config.io_rst));
 
+    if (imu_config.io_wake != GPIO_NUM_NC)
+        outputs_config.pin_bit_mask |= (1ULL << imu_config.io_wake);
+
     outputs_config.mode = GPIO_MODE_OUTPUT;
     outputs_config.pull_down_en = GPIO_PULLDOWN_DISABLE;
     outputs_config.pull_up_en = GPIO_PULLUP_DISABLE;
@@ -538,7 +704,7 @@ esp_err_t BNO08x::init_gpio_outputs()
     {
         // clang-format off
         #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-        ESP_LOGE(TAG, "Initialization failed, failed to configure CS, and RST gpio.");
+        ESP_LOGE(TAG, "Initialization failed, failed to configure CS, RST, and WAKE gpio.");
         #endif
         // clang-format on
     }
@@ -573,6 +739,10 @@ esp_err_t BNO08x::init_gpio()
     gpio_set_level(imu_config.io_cs, 1);
     gpio_set_level(imu_config.io_rst, 1);
 
+    // PS0 must be high while the BNO08x comes out of reset to select SPI mode
+    if (imu_config.io_wake != GPIO_NUM_NC)
+        gpio_set_level(imu_config.io_wake, 1);
+
     return ret;
 }
 
@@ -605,6 +775,8 @@ esp_err_t BNO08x::init_hint_isr()
                                         // (this will be ignored if imu_config.install_isr_service == false)
     }
 
+    sync_ctx.hint_route.io_int = imu_config.io_int;
+
     ret = gpio_isr_handler_add(imu_config.io_int, hint_handler, (void*) this);
     if (ret != ESP_OK)
     {
@@ -637,13 +809,26 @@ esp_err_t BNO08x::init_tasks()
     xEventGroupSetBits(sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASKS_RUNNING);
 
     // launch data processing task 6
-    task_created = xTaskCreatePinnedToCore(
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    data_proc_task_hdl = xTaskCreateStaticPinnedToCore(
+            &data_proc_task_trampoline, "bno08x_data_processing_task", 
+            DATA_PROC_TASK_SZ, 
+            this, 
+            DATA_PROC_TASK_PRIORITY, 
+            data_proc_task_stack, 
+            &data_proc_task_buffer, 
+            DATA_PROC_TASK_AFFINITY);
+    #else
+    data_proc_task_hdl = mem.create_task(data_proc_task_mem,
             &data_proc_task_trampoline, "bno08x_data_processing_task", 
             DATA_PROC_TASK_SZ, 
             this, 
             DATA_PROC_TASK_PRIORITY, 
-            &data_proc_task_hdl, 
             DATA_PROC_TASK_AFFINITY);
+    #endif
+    task_created = (data_proc_task_hdl != NULL) ? pdTRUE : pdFALSE;
+    // clang-format on
 
     if (task_created != pdTRUE)
     {
@@ -660,19 +845,33 @@ esp_err_t BNO08x::init_tasks()
         init_status.data_proc_task = true;
     }
 
-    // launch cb task 5
-    task_created = xTaskCreatePinnedToCore(&cb_task_trampoline, "bno08x_cb_task", 
-        CB_TASK_SZ, 
-        this, 
-        CB_TASK_PRIORITY, 
-        &cb_task_hdl, 
-        CB_TASK_AFFINITY);
+    // launch low lane data processing task 4
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    data_proc_low_task_hdl = xTaskCreateStaticPinnedToCore(
+            &data_proc_low_task_trampoline, "bno08x_data_processing_low_task", 
+            DATA_PROC_LOW_TASK_SZ, 
+            this, 
+            DATA_PROC_LOW_TASK_PRIORITY, 
+            data_proc_low_task_stack, 
+            &data_proc_low_task_buffer, 
+            DATA_PROC_LOW_TASK_AFFINITY);
+    #else
+    data_proc_low_task_hdl = mem.create_task(data_proc_low_task_mem,
+            &data_proc_low_task_trampoline, "bno08x_data_processing_low_task", 
+            DATA_PROC_LOW_TASK_SZ, 
+            this, 
+            DATA_PROC_LOW_TASK_PRIORITY, 
+            DATA_PROC_LOW_TASK_AFFINITY);
+    #endif
+    task_created = (data_proc_low_task_hdl != NULL) ? pdTRUE : pdFALSE;
+    // clang-format on
 
     if (task_created != pdTRUE)
     {
         // clang-format off
         #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-        ESP_LOGE(TAG, "Initialization failed, cb_task failed to launch.");
+        ESP_LOGE(TAG, "Initialization failed, data_proc_low_task failed to launch.");
         #endif
         // clang-format on
 
@@ -680,16 +879,68 @@ esp_err_t BNO08x::init_tasks()
     }
     else
     {
-        init_status.cb_task = true;
+        init_status.data_proc_low_task = true;
+    }
+
+    // launch cb task workers 5
+    for (uint8_t i = 0; i < CB_WORKER_COUNT; i++)
+    {
+        sync_ctx.cb_workers[i].imu = this;
+
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+        cb_task_hdl[i] = xTaskCreateStaticPinnedToCore(&cb_task_trampoline, "bno08x_cb_task", 
+            CB_TASK_SZ, 
+            &sync_ctx.cb_workers[i], 
+            CB_TASK_PRIORITY, 
+            cb_task_stack[i], 
+            &cb_task_buffer[i], 
+            cb_task_affinity(i));
+        #else
+        cb_task_hdl[i] = mem.create_task(cb_task_mem[i], &cb_task_trampoline, "bno08x_cb_task", 
+            CB_TASK_SZ, 
+            &sync_ctx.cb_workers[i], 
+            CB_TASK_PRIORITY, 
+            cb_task_affinity(i));
+        #endif
+        task_created = (cb_task_hdl[i] != NULL) ? pdTRUE : pdFALSE;
+        // clang-format on
+
+        if (task_created != pdTRUE)
+        {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+            ESP_LOGE(TAG, "Initialization failed, cb_task failed to launch.");
+            #endif
+            // clang-format on
+
+            return ESP_FAIL;
+        }
+        else
+        {
+            init_status.cb_task++;
+        }
     }
 
     // launch sh2 hal service task 7
-    task_created = xTaskCreatePinnedToCore(&sh2_HAL_service_task_trampoline, "bno08x_sh2_HAL_service_task", 
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    sh2_HAL_service_task_hdl = xTaskCreateStaticPinnedToCore(&sh2_HAL_service_task_trampoline, "bno08x_sh2_HAL_service_task", 
+        SH2_HAL_SERVICE_TASK_SZ, 
+        this, 
+        SH2_HAL_SERVICE_TASK_PRIORITY,
+        sh2_HAL_service_task_stack,
+        &sh2_HAL_service_task_buffer,
+        SH2_HAL_SERVICE_TASK_AFFINITY);
+    #else
+    sh2_HAL_service_task_hdl = mem.create_task(sh2_HAL_service_task_mem, &sh2_HAL_service_task_trampoline, "bno08x_sh2_HAL_service_task", 
         SH2_HAL_SERVICE_TASK_SZ, 
         this, 
         SH2_HAL_SERVICE_TASK_PRIORITY,
-        &sh2_HAL_service_task_hdl,
         SH2_HAL_SERVICE_TASK_AFFINITY);
+    #endif
+    task_created = (sh2_HAL_service_task_hdl != NULL) ? pdTRUE : pdFALSE;
+    // clang-format on
 
     if (task_created != pdTRUE)
     {
@@ -706,6 +957,11 @@ esp_err_t BNO08x::init_tasks()
         init_status.sh2_HAL_service_task = true;
     }
 
+    // HINTs asserted while nobody holds sh2_HAL_lock are now delivered to sh2_HAL_service_task()
+    lock_sh2_HAL();
+    sync_ctx.hint_route.service_task = sh2_HAL_service_task_hdl;
+    unlock_sh2_HAL();
+
     return ESP_OK;
 }
 
@@ -761,6 +1017,8 @@ esp_err_t BNO08x::init_spi()
  */
 esp_err_t BNO08x::init_sh2_HAL()
 {
+    int op_success = SH2_ERR;
+
     // use this IMU in sh2 HAL callbacks
     BNO08xSH2HAL::set_hal_imu(this);
 
@@ -774,7 +1032,12 @@ esp_err_t BNO08x::init_sh2_HAL()
     // reset BNO08x
     toggle_reset();
 
-    if (sh2_open(&sh2_HAL, BNO08xSH2HAL::hal_cb, NULL) != SH2_OK)
+    // HINTs are delivered to the holder of sh2_HAL_lock, sh2_HAL_service_task() is not running yet
+    lock_sh2_HAL();
+    op_success = sh2_open(&sh2_HAL, BNO08xSH2HAL::hal_cb, NULL);
+    unlock_sh2_HAL();
+
+    if (op_success != SH2_OK)
     {
         // clang-format off
         #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
@@ -789,7 +1052,11 @@ esp_err_t BNO08x::init_sh2_HAL()
 
     memset(&product_IDs, 0, sizeof(sh2_ProductIds_t));
 
-    if (sh2_getProdIds(&product_IDs) != SH2_OK)
+    lock_sh2_HAL();
+    op_success = sh2_getProdIds(&product_IDs);
+    unlock_sh2_HAL();
+
+    if (op_success != SH2_OK)
     {
         // clang-format off
         #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
@@ -897,6 +1164,21 @@ esp_err_t BNO08x::deinit_gpio_outputs()
         return ret;
     }
 
+    if (imu_config.io_wake != GPIO_NUM_NC)
+    {
+        ret = gpio_reset_pin(imu_config.io_wake);
+        if (ret != ESP_OK)
+        {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+            ESP_LOGE(TAG, "Deconstruction failed, could reset gpio WAKE pin to default state.");
+            #endif
+            // clang-format on
+
+            return ret;
+        }
+    }
+
     return ret;
 }
 
@@ -995,33 +1277,51 @@ esp_err_t BNO08x::deinit_tasks()
     uint8_t kill_count = 0;
     uint8_t init_count = 0;
     sh2_SensorEvent_t empty_event;
-    uint8_t empty_ID = 0;
+    bno08x_cb_evt_t empty_cb_evt;
 
     // disable interrupts before beginning so we can ensure SPI transaction doesn't attempt to run
     gpio_intr_disable(imu_config.io_int);
 
-    init_count += (static_cast<uint8_t>(init_status.cb_task) + static_cast<uint8_t>(init_status.data_proc_task) +
+    init_count += (init_status.cb_task + static_cast<uint8_t>(init_status.data_proc_task) +
+                   static_cast<uint8_t>(init_status.data_proc_low_task) +
                    static_cast<uint8_t>(init_status.sh2_HAL_service_task));
 
     if (init_count != 0)
     {
-        sem_kill_tasks = xSemaphoreCreateCounting(init_count, 0);
         xEventGroupClearBits(sync_ctx.evt_grp_task,
                 EVT_GRP_BNO08x_TASKS_RUNNING); // clear task running bit request deletion of tasks
 
-        if (init_status.cb_task)
-            xQueueSend(queue_cb_report_id, &empty_ID, 0);
+        // only the workers that were launched are woken, they are launched in order
+        for (uint8_t i = 0; i < init_status.cb_task; i++)
+        {
+            empty_cb_evt.rpt = nullptr;
+            xQueueSend(sync_ctx.cb_workers[i].queue_cb_evt, &empty_cb_evt, 0);
+            xSemaphoreGive(sync_ctx.cb_workers[i].sem_cb_evt);
+        }
 
         if (init_status.data_proc_task)
             xQueueSend(queue_rx_sensor_event, &empty_event, 0);
 
+        if (init_status.data_proc_low_task)
+            xQueueSend(queue_rx_sensor_event_low, &empty_event, 0);
+
         if (init_status.sh2_HAL_service_task)
-            xEventGroupSetBits(sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT | EVT_GRP_BNO08x_TASK_RESET_OCCURRED);
+        {
+            // stop delivering HINTs to the task before it is deleted
+            lock_sh2_HAL();
+            sync_ctx.hint_route.service_task = NULL;
+            unlock_sh2_HAL();
+
+            xTaskNotifyGiveIndexed(sh2_HAL_service_task_hdl, HINT_NOTIFY_INDEX);
+        }
 
         for (uint8_t i = 0; i < init_count; i++)
             if (xSemaphoreTake(sem_kill_tasks, TASK_DELETE_TIMEOUT_MS) == pdTRUE)
                 kill_count++;
 
+        if (kill_count == init_count)
+            init_status.cb_task = 0U;
+
         if (kill_count != init_count)
         {
             // clang-format off
@@ -1056,10 +1356,22 @@ esp_err_t BNO08x::deinit_sh2_HAL()
 /**
  * @brief Hard resets BNO08x device.
  *
- * @return True if reset was success.
+ * @return True if reset was success, false if it failed or the driver is suspended (see suspend()).
  */
 bool BNO08x::hard_reset()
 {
+    // a reset would re-enable HINT and wake the BNO08x behind suspend()'s back
+    if (sync_ctx.hint_route.suspended)
+    {
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGE(TAG, "Hard reset failure, driver is suspended, call resume() first.");
+        #endif
+        // clang-format on
+
+        return false;
+    }
+
     // toggle reset gpio
     toggle_reset();
 
@@ -1100,12 +1412,24 @@ bool BNO08x::hard_reset()
 /**
  * @brief Soft resets BNO08x device by sending RESET (1) command on "device" channel.
  *
- * @return True if soft reset operation succeeded.
+ * @return True if soft reset operation succeeded, false if it failed or the driver is suspended (see suspend()).
  */
 bool BNO08x::soft_reset()
 {
     int op_success = SH2_ERR;
 
+    // a reset would re-enable HINT and wake the BNO08x behind suspend()'s back
+    if (sync_ctx.hint_route.suspended)
+    {
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGE(TAG, "Soft reset failure, driver is suspended, call resume() first.");
+        #endif
+        // clang-format on
+
+        return false;
+    }
+
     // send reset command
     lock_sh2_HAL();
     op_success = sh2_devReset();
@@ -1158,45 +1482,117 @@ bool BNO08x::soft_reset()
 /**
  * @brief Disables all currently enabled reports.
  *
+ * All reports are disabled back to back with configure_reports().
+ *
  * @return True if all currently enabled reports were disabled successfully.
  */
 bool BNO08x::disable_all_reports()
 {
-    int attempts = 0;
+    etl::vector<bno08x_rpt_cfg_t, TOTAL_RPT_COUNT> rpt_cfgs;
 
     xEventGroupClearBits(sync_ctx.evt_grp_rpt_en, EVT_GRP_RPT_ALL);
 
-    while (sync_ctx.en_report_ids.size() != 0 && (attempts < TOTAL_RPT_COUNT))
+    lock_user_data();
+    for (const auto& rpt_ID : sync_ctx.en_report_ids)
+        rpt_cfgs.push_back(bno08x_rpt_cfg_t(usr_reports.at(rpt_ID), 0UL, default_sensor_cfg));
+    unlock_user_data();
+
+    return configure_reports(etl::span<const bno08x_rpt_cfg_t>(rpt_cfgs.data(), rpt_cfgs.size()));
+}
+
+/**
+ * @brief Enables and/or disables a set of reports, sending all set feature commands back to back.
+ *
+ * Instead of waiting a fixed delay after each command, every report is confirmed by the Get Feature Response the
+ * BNO08x sends once its config is applied (or by the arrival of its first sample if enabled), such that the whole
+ * set is configured within a single CONFIG_ESP32_BNO08X_RPT_CFG_ACK_TIMEOUT_MS.
+ *
+ * Example: imu.configure_reports({{&imu.rpt.rv_game, 10000UL}, {&imu.rpt.cal_gyro, 10000UL}, {&imu.rpt.gravity, 0UL}});
+ *
+ * @param rpt_cfgs Reports to configure and their period, a period of 0 disables the report.
+ *
+ * @return True if every report was configured and confirmed.
+ */
+bool BNO08x::configure_reports(etl::span<const bno08x_rpt_cfg_t> rpt_cfgs)
+{
+    uint32_t seq_before[BNO08xSubscriber::RPT_SLOT_COUNT] = {};
+    EventBits_t sent_mask = 0UL;
+    EventBits_t enabled_mask = 0UL;
+    EventBits_t unconfirmed_mask = 0UL;
+    bool success = true;
+    bool sent = false;
+
+    for (const bno08x_rpt_cfg_t& rpt_cfg : rpt_cfgs)
     {
-        uint8_t rpt_ID = sync_ctx.en_report_ids.back();
-        BNO08xRpt* rpt = usr_reports.at(rpt_ID);
+        BNO08xRpt* rpt = rpt_cfg.rpt;
+
         if (rpt == nullptr)
         {
             // clang-format off
             #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-            ESP_LOGE(TAG, "NULL pointer detected in usr_reports map for enabled report.");
+            ESP_LOGE(TAG, "NULL report pointer passed to configure_reports().");
             #endif
             // clang-format on
-            return false;
+            success = false;
+            continue;
         }
 
-        if (!rpt->disable())
+        seq_before[BNO08xSubscriber::rpt_slot(rpt->rpt_bit)] = rpt->seq;
+
+        // config acks of every report are awaited at once below
+        sent = (rpt_cfg.period_us != 0UL) ? rpt->rpt_enable(rpt_cfg.period_us, rpt_cfg.sensor_cfg, false)
+                                          : rpt->rpt_disable(rpt_cfg.sensor_cfg, false);
+
+        if (!sent)
         {
             // clang-format off
             #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
-            ESP_LOGE(TAG, "Failed to disable: %d", rpt->ID);
+            ESP_LOGE(TAG, "Failed to configure: %d", rpt->ID);
             #endif
             // clang-format on
-            return false;
+            success = false;
+            continue;
         }
 
-        attempts++;
+        sent_mask |= rpt->rpt_bit;
+        enabled_mask = (rpt_cfg.period_us != 0UL) ? (enabled_mask | rpt->rpt_bit) : (enabled_mask & ~rpt->rpt_bit);
     }
 
-    if (attempts < TOTAL_RPT_COUNT)
-        return true;
-    else
-        return false;
+    if (sent_mask == 0UL)
+        return success;
+
+    unconfirmed_mask = sent_mask & ~xEventGroupWaitBits(sync_ctx.evt_grp_rpt_cfg_ack, sent_mask, pdFALSE, pdTRUE,
+                                           BNO08xRpt::RPT_CFG_ACK_TIMEOUT_TICKS);
+
+    // enabled reports that already delivered a sample are confirmed regardless of their Get Feature Response
+    for (const bno08x_rpt_cfg_t& rpt_cfg : rpt_cfgs)
+        if ((rpt_cfg.rpt != nullptr) && (enabled_mask & rpt_cfg.rpt->rpt_bit) &&
+                (rpt_cfg.rpt->seq != seq_before[BNO08xSubscriber::rpt_slot(rpt_cfg.rpt->rpt_bit)]))
+            unconfirmed_mask &= ~rpt_cfg.rpt->rpt_bit;
+
+    if (unconfirmed_mask != 0UL)
+    {
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGE(TAG, "configure_reports(): BNO08x did not confirm report config, report bits: 0x%08" PRIx32, static_cast<uint32_t>(unconfirmed_mask));
+        #endif
+        // clang-format on
+        success = false;
+    }
+
+    return success;
+}
+
+/**
+ * @brief Enables and/or disables a set of reports, sending all set feature commands back to back.
+ *
+ * @param rpt_cfgs Reports to configure and their period, a period of 0 disables the report.
+ *
+ * @return True if every report was configured and confirmed.
+ */
+bool BNO08x::configure_reports(std::initializer_list<bno08x_rpt_cfg_t> rpt_cfgs)
+{
+    return configure_reports(etl::span<const bno08x_rpt_cfg_t>(rpt_cfgs.begin(), rpt_cfgs.size()));
 }
 
 /**
@@ -1264,38 +1660,106 @@ bool BNO08x::sleep()
 }
 
 /**
- * @brief Starts simple calibration, see ref. manual 6.4.10.1
- *
- * @param period_us This interval should be set to whatever rate the sensor hub is expected to run
- * at after calibration.
+ * @brief Suspends the driver without tearing it down, such that resume() restarts it within milliseconds.
  *
- * After the calibration is started, the IMU should be rotated 180 degrees.
- * After the IMU has been rotated call calibration_end().
- * See ref. manual 6.4.10 for more detailed instructions.
+ * The BNO08x is put to sleep, which keeps its report configuration, and HINT is disabled. The driver's tasks are not
+ * deleted, they stay parked waiting for HINT/samples. All driver state (enabled reports, callbacks, subscribers,
+ * history, etc.) is kept. Calls which communicate with the BNO08x fail until resume() is called, hard_reset() and
+ * soft_reset() are rejected.
  *
- * @return True if start simple calibration operation succeeded.
+ * @return True if suspended, false if already suspended or the sleep command failed.
  */
-/*
-bool BNO08x::calibration_turntable_start(uint32_t period_us)
+bool BNO08x::suspend()
 {
-    // currently broken, correct packet is sent over SPI but IMU responds
-    // with unsolicited initialize response instead of the expected Turntable Cal response (0x0C)
     int op_success = SH2_ERR;
 
     lock_sh2_HAL();
-    op_success = sh2_startCal(period_us);
+
+    if (!sync_ctx.hint_route.suspended)
+    {
+        op_success = sh2_devSleep();
+
+        if (op_success == SH2_OK)
+        {
+            sync_ctx.hint_route.suspended = true;
+            gpio_intr_disable(imu_config.io_int);
+        }
+    }
+
     unlock_sh2_HAL();
 
     return (op_success == SH2_OK);
 }
-*/
 
 /**
- * @brief Ends turn-table calibration, see ref. manual 6.4.10.2
+ * @brief Resumes a driver suspended with suspend(), the BNO08x continues sending the reports enabled before.
  *
- * @param status Returned status bits indicating result of turntable calibration.
+ * If the BNO08x reset while suspended, the reset is detected and recovered from as usual once resumed.
  *
- * @return True if enable start turn-table calibration operation succeeded.
+ * @return True if resumed, false if not suspended or the on command failed.
+ */
+bool BNO08x::resume()
+{
+    int op_success = SH2_ERR;
+
+    lock_sh2_HAL();
+
+    if (sync_ctx.hint_route.suspended)
+    {
+        sync_ctx.hint_route.suspended = false;
+        gpio_intr_enable(imu_config.io_int);
+
+        op_success = sh2_devOn();
+
+        if (op_success != SH2_OK)
+        {
+            gpio_intr_disable(imu_config.io_int);
+            sync_ctx.hint_route.suspended = true;
+        }
+    }
+
+    unlock_sh2_HAL(); // hands HINTs asserted while suspended to sh2_HAL_service_task()
+
+    // un-park sh2_HAL_service_task() such that it polls again in BNO08xHintMode::BUSY_POLL
+    if ((op_success == SH2_OK) && (sync_ctx.hint_route.service_task != NULL))
+        xTaskNotifyGiveIndexed(sync_ctx.hint_route.service_task, HINT_NOTIFY_INDEX);
+
+    return (op_success == SH2_OK);
+}
+
+/**
+ * @brief Starts simple calibration, see ref. manual 6.4.10.1
+ *
+ * @param period_us This interval should be set to whatever rate the sensor hub is expected to run
+ * at after calibration.
+ *
+ * After the calibration is started, the IMU should be rotated 180 degrees.
+ * After the IMU has been rotated call calibration_end().
+ * See ref. manual 6.4.10 for more detailed instructions.
+ *
+ * @return True if start simple calibration operation succeeded.
+ */
+/*
+bool BNO08x::calibration_turntable_start(uint32_t period_us)
+{
+    // currently broken, correct packet is sent over SPI but IMU responds
+    // with unsolicited initialize response instead of the expected Turntable Cal response (0x0C)
+    int op_success = SH2_ERR;
+
+    lock_sh2_HAL();
+    op_success = sh2_startCal(period_us);
+    unlock_sh2_HAL();
+
+    return (op_success == SH2_OK);
+}
+*/
+
+/**
+ * @brief Ends turn-table calibration, see ref. manual 6.4.10.2
+ *
+ * @param status Returned status bits indicating result of turntable calibration.
+ *
+ * @return True if enable start turn-table calibration operation succeeded.
  */
 /*bool BNO08x::calibration_turntable_end(sh2_CalStatus_t& status)
 {
@@ -1324,6 +1788,12 @@ bool BNO08x::dynamic_calibration_enable(BNO08xCalSel sensor)
     op_success = sh2_setCalConfig(static_cast<uint8_t>(sensor));
     unlock_sh2_HAL();
 
+    if (op_success == SH2_OK)
+    {
+        hub_cfg.cal_config = static_cast<uint8_t>(sensor);
+        hub_cfg.cal_config_set = true;
+    }
+
     return (op_success == SH2_OK);
 }
 
@@ -1351,6 +1821,12 @@ bool BNO08x::dynamic_calibration_disable(BNO08xCalSel sensor)
         lock_sh2_HAL();
         op_success = sh2_setCalConfig(active_sensors);
         unlock_sh2_HAL();
+
+        if (op_success == SH2_OK)
+        {
+            hub_cfg.cal_config = active_sensors;
+            hub_cfg.cal_config_set = true;
+        }
     }
 
     return (op_success == SH2_OK);
@@ -1370,6 +1846,12 @@ bool BNO08x::dynamic_calibration_autosave_enable()
     op_success = sh2_setDcdAutoSave(true);
     unlock_sh2_HAL();
 
+    if (op_success == SH2_OK)
+    {
+        hub_cfg.dcd_autosave = true;
+        hub_cfg.dcd_autosave_set = true;
+    }
+
     return (op_success == SH2_OK);
 }
 
@@ -1387,6 +1869,12 @@ bool BNO08x::dynamic_calibration_autosave_disable()
     op_success = sh2_setDcdAutoSave(false);
     unlock_sh2_HAL();
 
+    if (op_success == SH2_OK)
+    {
+        hub_cfg.dcd_autosave = false;
+        hub_cfg.dcd_autosave_set = true;
+    }
+
     return (op_success == SH2_OK);
 }
 
@@ -1790,22 +2278,188 @@ sh2_ProductIds_t BNO08x::get_product_IDs()
 }
 
 /**
- * @brief Waits for HINT pin assertion or HOST_INT_TIMEOUT_DEFAULT_MS to elapse.
+ * @brief Waits for HINT pin assertion or timeout to elapse.
  *
+ * Must be called by the task holding sh2_HAL_lock, which hint_handler() wakes directly, with a task notification if it
+ * is sh2_HAL_service_task() and through bno08x_hint_route_t::sem_hint otherwise.
+ *
+ * @param timeout_ticks Max time to wait in ticks.
  *
  * @return ESP_OK if HINT was asserted.
  */
-esp_err_t BNO08x::wait_for_hint()
+esp_err_t BNO08x::wait_for_hint(TickType_t timeout_ticks)
 {
-    EventBits_t spi_evt_bits;
+    TimeOut_t timeout;
+    TickType_t ticks_remaining = timeout_ticks;
+    const bool service_task = (xTaskGetCurrentTaskHandle() == sync_ctx.hint_route.service_task);
 
-    spi_evt_bits = xEventGroupWaitBits(
-            sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT, pdTRUE, pdFALSE, HOST_INT_TIMEOUT_DEFAULT_MS);
+    vTaskSetTimeOutState(&timeout);
 
-    if (spi_evt_bits & EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT)
-        return ESP_OK;
-    else
+    // notifications may be stale or have gone to the previous owner, so always act on the HINT level
+    while (!sync_ctx.hint_route.asserted())
+    {
+        if (xTaskCheckForTimeOut(&timeout, &ticks_remaining) == pdTRUE)
+            return ESP_ERR_TIMEOUT;
+
+        if (service_task)
+            ulTaskNotifyTakeIndexed(HINT_NOTIFY_INDEX, pdTRUE, ticks_remaining);
+        else
+            xSemaphoreTake(sync_ctx.hint_route.sem_hint, ticks_remaining);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Waits for HINT, escalating timeouts step by step instead of hard resetting the IMU on the first one.
+ *
+ * A timed out wait is retried HINT_TIMEOUT_RETRIES times, doubling the timeout each retry up to HINT_TIMEOUT_MAX_TICKS.
+ * If HINT is still not asserted, the hub is only considered stuck if a HINT was due (see hint_due()). An idle hub
+ * fails the transaction without a reset. A stuck hub is first soft reset by sh2_HAL_service_task() (if
+ * CONFIG_ESP32_BNO08X_HINT_TIMEOUT_SOFT_RESET is enabled and WAKE is connected), and hard reset if it is still stuck
+ * afterwards. Without WAKE the reset command would wait on the same stuck HINT, so the hub is hard reset directly.
+ *
+ * @return ESP_OK if HINT was asserted, ESP_ERR_TIMEOUT if the transaction should fail, ESP_ERR_INVALID_STATE if the
+ * driver is suspended, ESP_FAIL if the IMU must be hard reset.
+ */
+esp_err_t BNO08x::wait_for_hint_recover()
+{
+    bno08x_hint_recovery_t& recovery = sync_ctx.hint_recovery;
+    TickType_t timeout = HOST_INT_TIMEOUT_DEFAULT_MS;
+    const int64_t start_us = esp_timer_get_time();
+
+    // the BNO08x sleeps and HINT is disabled, fail without escalating to a reset
+    if (sync_ctx.hint_route.suspended)
+        return ESP_ERR_INVALID_STATE;
+
+    for (uint8_t retry = 0U; retry <= HINT_TIMEOUT_RETRIES; retry++)
+    {
+        if (retry != 0U)
+        {
+            recovery.stats.retries++;
+            timeout = etl::min<TickType_t>(timeout * 2U, HINT_TIMEOUT_MAX_TICKS);
+        }
+
+        if (wait_for_hint(timeout) == ESP_OK)
+        {
+            if (retry != 0U)
+                recovery.stats.recovered++;
+
+            return ESP_OK;
+        }
+
+        recovery.stats.timeouts++;
+    }
+
+    if (!hint_due(esp_timer_get_time() - start_us))
+    {
+        recovery.stats.idle_timeouts++;
         return ESP_ERR_TIMEOUT;
+    }
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_HINT_TIMEOUT_SOFT_RESET
+    // WAKE makes the hub assert HINT for the reset command even though it stopped asserting it for data
+    if (!recovery.soft_reset_issued && (imu_config.io_wake != GPIO_NUM_NC))
+    {
+        recovery.soft_reset_issued = true;
+
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGW(TAG, "HINT stuck, requesting soft reset.");
+        #endif
+
+        // the sh2 HAL lib is mid transaction, the reset command is sent once it has returned
+        xEventGroupSetBits(sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASK_SOFT_RESET_REQUESTED);
+        if (sync_ctx.hint_route.service_task != NULL)
+            xTaskNotifyGiveIndexed(sync_ctx.hint_route.service_task, HINT_NOTIFY_INDEX);
+
+        return ESP_ERR_TIMEOUT;
+    }
+    #endif
+
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    ESP_LOGE(TAG, "HINT stuck, hard resetting.");
+    #endif
+    // clang-format on
+
+    recovery.stats.hard_resets++;
+
+    return ESP_FAIL;
+}
+
+/**
+ * @brief Checks if the BNO08x should have asserted HINT within a wait, used to tell an idle hub from a stuck one.
+ *
+ * The hub asserts HINT at least once per period of its fastest enabled continuous report. Detector and classifier
+ * reports only report on events and are not considered, regardless of the lane they are processed in.
+ *
+ * @param waited_us Time waited for HINT.
+ *
+ * @return True if at least two periods of the fastest enabled continuous report elapsed during the wait.
+ */
+bool BNO08x::hint_due(int64_t waited_us)
+{
+    EventBits_t rpt_en_bits = xEventGroupGetBits(sync_ctx.evt_grp_rpt_en);
+    uint32_t period_min_us = UINT32_MAX;
+
+    for (const auto& entry : usr_reports)
+    {
+        BNO08xRpt* rpt = entry.second;
+
+        if ((rpt == nullptr) || !(rpt->rpt_bit & rpt_en_bits) || !rpt->continuous ||
+                (rpt->period_us == 0UL))
+            continue;
+
+        period_min_us = etl::min(period_min_us, rpt->period_us);
+    }
+
+    // no continuous report enabled, the hub has nothing to send
+    if (period_min_us == UINT32_MAX)
+        return false;
+
+    return waited_us >= (2LL * static_cast<int64_t>(period_min_us));
+}
+
+/**
+ * @brief Spins on the HINT level from sh2_HAL_service_task() in BNO08xHintMode::BUSY_POLL.
+ *
+ * The delay between polls doubles while HINT stays idle, up to HINT_POLL_BACKOFF_MAX_US, such that the worst case
+ * detection delay is bounded while the bus is not hammered between samples.
+ *
+ * @return True if HINT was asserted or the task was notified, false if HINT stayed idle for HINT_POLL_IDLE_US (or the
+ * mode was changed) and the task should wait for hint_handler() instead.
+ */
+bool BNO08x::poll_for_hint()
+{
+    bno08x_hint_route_t& route = sync_ctx.hint_route;
+    const int64_t start_us = esp_timer_get_time();
+    uint32_t backoff_us = 0UL;
+
+    route.polling = true;
+
+    while (!route.asserted())
+    {
+        // woken by hal_cb(), deinit_tasks() or set_hint_mode(), the caller checks why
+        if (ulTaskNotifyTakeIndexed(HINT_NOTIFY_INDEX, pdTRUE, 0) != 0UL)
+            break;
+
+        if ((route.mode != BNO08xHintMode::BUSY_POLL) || route.suspended ||
+                ((esp_timer_get_time() - start_us) >= HINT_POLL_IDLE_US))
+        {
+            route.polling = false;
+            // hint_handler() did not notify assertions that happened while polling was set
+            return route.asserted();
+        }
+
+        if (backoff_us != 0UL)
+            esp_rom_delay_us(backoff_us);
+
+        backoff_us = etl::min<uint32_t>((backoff_us == 0UL) ? 1UL : (backoff_us * 2UL), HINT_POLL_BACKOFF_MAX_US);
+    }
+
+    route.polling = false;
+
+    return true;
 }
 
 /**
@@ -1836,21 +2490,161 @@ void BNO08x::toggle_reset()
 
     gpio_set_level(imu_config.io_cs, 1);
 
+    // PS0 selects SPI mode when sampled high as the BNO08x comes out of reset
+    if (imu_config.io_wake != GPIO_NUM_NC)
+        gpio_set_level(imu_config.io_wake, 1);
+
     gpio_set_level(imu_config.io_rst, 0); // set reset pin low
     vTaskDelay(HARD_RESET_DELAY_MS);      // 10ns min, set to larger delay to let things stabilize(Anton)
     gpio_intr_enable(imu_config.io_int);  // enable interrupts before bringing out of reset
     gpio_set_level(imu_config.io_rst, 1); // bring out of reset
 }
 
+/**
+ * @brief Restores the state lost by an IMU reset and completes its log entry (called when BNO08x reset is detected by
+ * sh2 HAL lib).
+ *
+ * Report configs are sent first as one burst such that data resumes before the calibration commands, which each
+ * await a response, are sent. The reset reason is queried last for the same reason. The reset was already logged and
+ * counted by BNO08xSH2HAL::hal_cb(), if the reports cannot be re-enabled EVT_GRP_BNO08x_TASK_RESET_OCCURRED stays set
+ * and only the restore is retried on the next call.
+ *
+ * @return ESP_OK if report and calibration configs were successfully restored.
+ */
+esp_err_t BNO08x::recover_from_reset()
+{
+    BNO08xPrivateTypes::bno08x_reset_tracker_t& tracker = sync_ctx.reset_tracker;
+    BNO08xResetReason reason = BNO08xResetReason::UNDEFINED;
+    uint32_t recovery_us = 0UL;
+    esp_err_t ret = ESP_OK;
+    float rate_sum_hz = 0.0f;
+    uint8_t rpt_count = 0U;
+
+    if (re_enable_reports() != ESP_OK)
+        return ESP_FAIL;
+
+    if (restore_hub_cfg() != ESP_OK)
+        ret = ESP_FAIL;
+
+    reason = get_reset_reason();
+
+    lock_user_data();
+
+    recovery_us = static_cast<uint32_t>(esp_timer_get_time() - tracker.reset_detected_us);
+
+    for (const auto& rpt_ID : sync_ctx.en_report_ids)
+    {
+        BNO08xRpt* rpt = usr_reports.at(rpt_ID);
+
+        if ((rpt != nullptr) && (rpt->period_us != 0UL))
+        {
+            rate_sum_hz += 1000000.0f / static_cast<float>(rpt->period_us);
+            rpt_count++;
+        }
+    }
+
+    tracker.rate_sum_hz = rate_sum_hz;
+    tracker.rpt_count = rpt_count;
+
+    // the entry may have been cleared by clear_reset_log() since the reset was detected
+    if (tracker.entry_pending && !tracker.log.empty())
+    {
+        bno08x_reset_log_entry_t& entry = tracker.log.back();
+
+        entry.recovery_us = recovery_us;
+        entry.reason = reason;
+
+        if (rpt_count == 0U)
+            tracker.awaiting_sample = false; // no data to resume, nothing was lost
+        else if (tracker.first_sample_us != 0LL)
+            tracker.complete(entry); // data already resumed while configs were being restored
+        else
+            tracker.entry_incomplete = true; // completed by reset_recovered()
+    }
+    else if (rpt_count == 0U)
+    {
+        tracker.awaiting_sample = false;
+    }
+
+    tracker.entry_pending = false;
+
+    unlock_user_data();
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    ESP_LOGW(TAG, "IMU reset detected, reason: %d, configs restored in %" PRIu32 "us.", static_cast<uint8_t>(reason),
+            recovery_us);
+    #endif
+    // clang-format on
+
+    return ret;
+}
+
+/**
+ * @brief Completes the log entry of the most recent reset, called from BNO08xSH2HAL::sensor_event_cb() for the first
+ * sample received after a reset.
+ *
+ * @param time_us Time the sample was received.
+ *
+ * @return void, nothing to return
+ */
+void BNO08x::reset_recovered(int64_t time_us)
+{
+    BNO08xPrivateTypes::bno08x_reset_tracker_t& tracker = sync_ctx.reset_tracker;
+
+    sync_ctx.hint_recovery.soft_reset_issued = false; // data flows again, a later stuck hub starts over at a soft reset
+
+    lock_user_data();
+    tracker.awaiting_sample = false;
+    tracker.first_sample_us = time_us;
+    if (tracker.entry_incomplete && !tracker.log.empty())
+        tracker.complete(tracker.log.back());
+    tracker.entry_incomplete = false;
+    unlock_user_data();
+}
+
+/**
+ * @brief Re-applies hub settings set by the user which do not persist through a reset (dynamic calibration config
+ * and dynamic calibration data autosave).
+ *
+ * System orientation is stored in FRS and persists through resets, so it does not need to be restored.
+ *
+ * @return ESP_OK if all settings were successfully restored.
+ */
+esp_err_t BNO08x::restore_hub_cfg()
+{
+    int op_success = SH2_OK;
+
+    if (hub_cfg.cal_config_set)
+    {
+        lock_sh2_HAL();
+        op_success = sh2_setCalConfig(hub_cfg.cal_config);
+        unlock_sh2_HAL();
+    }
+
+    if ((op_success == SH2_OK) && hub_cfg.dcd_autosave_set)
+    {
+        lock_sh2_HAL();
+        op_success = sh2_setDcdAutoSave(hub_cfg.dcd_autosave);
+        unlock_sh2_HAL();
+    }
+
+    return (op_success == SH2_OK) ? ESP_OK : ESP_FAIL;
+}
+
 /**
  * @brief Re-enables all reports enabled by user (called when BNO08x reset is detected by sh2 HAL
  * lib).
  *
+ * Called from sh2_HAL_service_task(), which is the task that receives config acks, so set feature commands are
+ * sent back to back without awaiting them.
+ *
  * @return ESP_OK if enabled reports were successfuly re-enabled.
  */
 esp_err_t BNO08x::re_enable_reports()
 {
     EventBits_t report_en_bits = xEventGroupGetBits(sync_ctx.evt_grp_rpt_en);
+    bool sent = false;
 
     for (const auto& rpt_ID : sync_ctx.en_report_ids)
     {
@@ -1867,7 +2661,9 @@ esp_err_t BNO08x::re_enable_reports()
 
         if (rpt->rpt_bit & report_en_bits)
         {
-            if (!rpt->enable(rpt->period_us))
+            sent = rpt->rpt_enable(rpt->period_us, default_sensor_cfg, false);
+
+            if (!sent)
             {
                 // clang-format off
                 #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
@@ -1901,40 +2697,507 @@ bool BNO08x::data_available()
 }
 
 /**
- * @brief Registers a callback to execute when new data from a report is received.
+ * @brief Waits until any or all of a set of reports have received new data.
  *
- * @param cb_fxn Pointer to the call-back function should be of void return type void input param.
+ * Reports that caused the return are consumed, as if has_new_data() was called on them.
+ *
+ * @param rpt_mask Reports to wait for, built by OR'ing BNO08xRpt::get_rpt_bit() of each report.
+ * @param mode BNO08xWaitMode::ANY to return on the first update, BNO08xWaitMode::ALL to wait for every report.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return Mask of reports that updated, 0 if timeout_ms elapsed first.
+ */
+EventBits_t BNO08x::wait_for(EventBits_t rpt_mask, BNO08xWaitMode mode, uint32_t timeout_ms)
+{
+    EventBits_t updated = 0UL;
+
+    rpt_mask &= EVT_GRP_RPT_ALL;
+
+    if (rpt_mask == 0UL)
+        return 0UL;
+
+    updated = xEventGroupWaitBits(sync_ctx.evt_grp_rpt_data_available, rpt_mask, pdTRUE,
+                      (mode == BNO08xWaitMode::ALL) ? pdTRUE : pdFALSE, timeout_ms / portTICK_PERIOD_MS) &
+              rpt_mask;
+
+    // on timeout bits are returned without being cleared, only report a partial set as updated in ANY mode
+    if ((mode == BNO08xWaitMode::ALL) && (updated != rpt_mask))
+        return 0UL;
+
+    return updated;
+}
+
+/**
+ * @brief Returns counts of samples lost at each stage of the processing pipeline.
+ *
+ * Counters are incremented atomically by the driver tasks, they can be read at any time without locking.
+ *
+ * @return Struct containing the drop counters.
+ */
+bno08x_drop_stats_t BNO08x::get_drop_stats()
+{
+    return sync_ctx.drop_stats;
+}
+
+/**
+ * @brief Copies the log of the most recent IMU resets, oldest first.
+ *
+ * Each entry holds the reset's reason, time taken to restore report and calibration configs, downtime and estimated
+ * samples lost. Downtime and samples lost remain 0 until the first sample after the reset is received.
+ *
+ * @param entries Buffer to copy log entries to, up to CONFIG_ESP32_BNO08X_RESET_LOG_SZ entries are held.
+ *
+ * @return Amount of entries copied.
+ */
+size_t BNO08x::get_reset_log(etl::span<bno08x_reset_log_entry_t> entries)
+{
+    size_t count = 0U;
+
+    lock_user_data();
+    for (const auto& entry : sync_ctx.reset_tracker.log)
+    {
+        if (count == entries.size())
+            break;
+
+        entries[count++] = entry;
+    }
+    unlock_user_data();
+
+    return count;
+}
+
+/**
+ * @brief Returns the amount of IMU resets detected since initialization, including those no longer held by the
+ * reset log.
+ *
+ * @return Amount of resets detected.
+ */
+uint32_t BNO08x::get_reset_count()
+{
+    return sync_ctx.reset_tracker.reset_count;
+}
+
+/**
+ * @brief Clears the reset log, get_reset_count() is unaffected.
+ *
+ * @return void, nothing to return
+ */
+void BNO08x::clear_reset_log()
+{
+    lock_user_data();
+    sync_ctx.reset_tracker.log.clear();
+    sync_ctx.reset_tracker.entry_incomplete = false;
+    sync_ctx.reset_tracker.entry_pending = false;
+    unlock_user_data();
+}
+
+/**
+ * @brief Resets counts of samples lost at each stage of the processing pipeline to 0.
+ *
+ * @return void, nothing to return
+ */
+void BNO08x::clear_drop_stats()
+{
+    sync_ctx.drop_stats = bno08x_drop_stats_t();
+}
+
+/**
+ * @brief Returns counts of HINT wait timeouts and the escalations taken to recover from them.
+ *
+ * The counters are only written by the task holding the sh2 HAL lock, they can be read at any time without locking,
+ * such that reading them never waits out a recovery in progress.
+ *
+ * @return Struct containing the recovery counters.
+ */
+bno08x_hint_recovery_stats_t BNO08x::get_hint_recovery_stats()
+{
+    return sync_ctx.hint_recovery.stats;
+}
+
+/**
+ * @brief Resets counts of HINT wait timeouts and escalations to 0.
+ *
+ * @return void, nothing to return
+ */
+void BNO08x::clear_hint_recovery_stats()
+{
+    sync_ctx.hint_recovery.stats = bno08x_hint_recovery_stats_t();
+}
+
+/**
+ * @brief Sets how sh2_HAL_service_task() waits for the BNO08x to assert HINT.
+ *
+ * BNO08xHintMode::BUSY_POLL trades CPU for HINT-to-sample latency and jitter, sh2_HAL_service_task() spins on the HINT
+ * level with adaptive back-off (see CONFIG_ESP32_BNO08X_HINT_POLL_BACKOFF_MAX_US) and only falls back to the HINT ISR
+ * after HINT was idle for CONFIG_ESP32_BNO08X_HINT_POLL_IDLE_US. Intended for a core dedicated to the IMU, the idle
+ * task of that core is starved while samples are flowing.
+ *
+ * @param mode The HINT mode to use.
  *
  * @return void, nothing to return
  */
-bool BNO08x::register_cb(std::function<void(void)> cb_fxn)
+void BNO08x::set_hint_mode(BNO08xHintMode mode)
 {
+    TaskHandle_t service_task = sync_ctx.hint_route.service_task;
+
+    sync_ctx.hint_route.mode = mode;
+
+    // start polling right away instead of after the next HINT
+    if (service_task != NULL)
+        xTaskNotifyGiveIndexed(service_task, HINT_NOTIFY_INDEX);
+}
 
-    if (sync_ctx.cb_list.size() < CONFIG_ESP32_BNO08X_CB_MAX)
+/**
+ * @brief Returns how sh2_HAL_service_task() waits for the BNO08x to assert HINT.
+ *
+ * @return The current HINT mode.
+ */
+BNO08xHintMode BNO08x::get_hint_mode()
+{
+    return sync_ctx.hint_route.mode;
+}
+
+/**
+ * @brief Creates a subscriber such that a task can consume reports without stealing updates from other tasks.
+ *
+ * Each consuming task should create its own subscriber and subscribe it to the reports it reads (see
+ * BNO08xSubscriber::subscribe()).
+ *
+ * @return Pointer to the subscriber, nullptr if CONFIG_ESP32_BNO08X_SUBSCRIBER_MAX subscribers already exist.
+ */
+BNO08xSubscriber* BNO08x::create_subscriber()
+{
+    BNO08xSubscriber* created = nullptr;
+
+    lock_user_data();
+    for (BNO08xSubscriber& subscriber : sync_ctx.subscribers)
     {
-        sync_ctx.cb_list.push_back(BNO08xCbParamVoid(cb_fxn, 0U));
-        return true;
+        if (subscriber.in_use)
+            continue;
+
+        // semaphores are created on first use and kept for the lifetime of the driver object
+        if (subscriber.sem_wake == NULL)
+        {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+            subscriber.sem_wake = xSemaphoreCreateBinaryStatic(&subscriber.sem_wake_buffer);
+            #else
+            subscriber.sem_wake = mem.create_binary_semaphore();
+            #endif
+            // clang-format on
+
+            if (subscriber.sem_wake == NULL)
+                break;
+        }
+
+        xSemaphoreTake(subscriber.sem_wake, 0); // discard give left over from a previous owner
+        subscriber.rpt_mask = 0UL;
+        subscriber.in_use = true;
+        created = &subscriber;
+        break;
     }
-    return false;
+    unlock_user_data();
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    if (created == nullptr)
+        ESP_LOGE(TAG, "Failed to create subscriber, max of %d reached or out of memory.", CONFIG_ESP32_BNO08X_SUBSCRIBER_MAX);
+    #endif
+    // clang-format on
+
+    return created;
+}
+
+/**
+ * @brief Destroys a subscriber created with create_subscriber(), returning it to the pool.
+ *
+ * @param subscriber The subscriber to destroy, must not be used after this call.
+ *
+ * @return True if subscriber was destroyed, false if it was not created by this BNO08x object.
+ */
+bool BNO08x::destroy_subscriber(BNO08xSubscriber* subscriber)
+{
+    bool destroyed = false;
+
+    lock_user_data();
+    for (BNO08xSubscriber& pool_subscriber : sync_ctx.subscribers)
+    {
+        if ((&pool_subscriber == subscriber) && pool_subscriber.in_use)
+        {
+            pool_subscriber.rpt_mask = 0UL;
+            pool_subscriber.in_use = false;
+            destroyed = true;
+            break;
+        }
+    }
+    unlock_user_data();
+
+    return destroyed;
+}
+
+/**
+ * @brief Registers a callback to execute when new data from a report is received.
+ *
+ * Deferred callbacks registered to all reports execute on one callback worker (CB_WORKER_GLOBAL) in order, never
+ * concurrently. Inline callbacks registered to all reports execute within the data_proc_task() of each lane and must
+ * be reentrant if reports are processed in both lanes.
+ *
+ * @param cb_fxn Pointer to the call-back function should be of void return type void input param.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within
+ * data_proc_task() (must be short and never block).
+ *
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08x::register_cb(BNO08xCbFunction<void(void)> cb_fxn, BNO08xCbExec exec)
+{
+    return cb_list_register(sync_ctx,
+            (exec == BNO08xCbExec::INLINE) ? sync_ctx.cb_list_inline_head : sync_ctx.cb_list_head,
+            BNO08xCbParamVoid(cb_fxn, 0U));
 }
 
 /**
  * @brief Registers a callback to execute when new data from a report is received, overloaded with
  * callback param for most recent report ID.
  *
+ * Executed on the same tasks as the overload without params, see its description.
+ *
  * @param cb_fxn Pointer to the call-back function should be of void return type with single input
  * param of uint8_t for most recent report ID.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within
+ * data_proc_task() (must be short and never block).
  *
- * @return void, nothing to return
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08x::register_cb(BNO08xCbFunction<void(uint8_t report_ID)> cb_fxn, BNO08xCbExec exec)
+{
+    return cb_list_register(sync_ctx,
+            (exec == BNO08xCbExec::INLINE) ? sync_ctx.cb_list_inline_head : sync_ctx.cb_list_head,
+            BNO08xCbParamRptID(cb_fxn, 0U));
+}
+
+/**
+ * @brief Unregisters a callback registered to this IMU or any of its reports, such that it is no longer invoked.
+ *
+ * Safe to call at any time, including from within a callback and while callbacks are being dispatched, dispatch is
+ * never paused. An invocation of the callback already in progress on another task finishes normally. The callback's
+ * slot is reused by a later registration once no dispatcher can reach it anymore.
+ *
+ * @param handle Handle returned from register_cb().
+ *
+ * @return True if the callback was unregistered, false if the handle is invalid or was already unregistered.
+ */
+bool BNO08x::unregister_cb(bno08x_cb_handle_t handle)
+{
+    return cb_list_unregister(sync_ctx, handle);
+}
+
+/**
+ * @brief Returns the amount of callbacks registered to this IMU and its reports.
+ *
+ * @return Amount of registered callbacks.
+ */
+size_t BNO08x::get_cb_count()
+{
+    size_t cb_count = 0;
+
+    xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+    for (size_t i = 0; i < sync_ctx.cb_list.size(); i++)
+        if (cb_list_at(sync_ctx, i) != nullptr)
+            cb_count++;
+
+    xSemaphoreGive(sync_ctx.cb_list_lock);
+
+    return cb_count;
+}
+
+/**
+ * @brief Returns execution statistics of a registered callback.
+ *
+ * Statistics are written by the task executing the callback without locking, an inline callback registered to all
+ * reports that executes in both lanes concurrently may miss counts.
+ *
+ * @param handle Handle returned when the callback was registered.
+ * @param stats Struct to save the statistics to.
+ *
+ * @return True if stats were retrieved, false if the handle is invalid or its callback was unregistered.
+ */
+bool BNO08x::get_cb_stats(bno08x_cb_handle_t handle, bno08x_cb_stats_t& stats)
+{
+    BNO08xCbGeneric* cb_entry = nullptr;
+
+    // the slot cannot be unregistered and reused by another callback while it is read
+    xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+    cb_entry = cb_list_lookup(sync_ctx, handle);
+
+    if (cb_entry != nullptr)
+        stats = cb_entry->stats;
+
+    xSemaphoreGive(sync_ctx.cb_list_lock);
+
+    return (cb_entry != nullptr);
+}
+
+/**
+ * @brief Resets execution statistics of a registered callback.
+ *
+ * @param handle Handle returned when the callback was registered.
+ *
+ * @return True if stats were cleared, false if the handle is invalid or its callback was unregistered.
  */
-bool BNO08x::register_cb(std::function<void(uint8_t report_ID)> cb_fxn)
+bool BNO08x::clear_cb_stats(bno08x_cb_handle_t handle)
 {
-    if (sync_ctx.cb_list.size() < CONFIG_ESP32_BNO08X_CB_MAX)
+    BNO08xCbGeneric* cb_entry = nullptr;
+
+    xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+    cb_entry = cb_list_lookup(sync_ctx, handle);
+
+    if (cb_entry != nullptr)
+        cb_entry->stats = bno08x_cb_stats_t();
+
+    xSemaphoreGive(sync_ctx.cb_list_lock);
+
+    return (cb_entry != nullptr);
+}
+
+/**
+ * @brief Sets an execution time budget for a registered callback, executions exceeding it are counted as overruns.
+ *
+ * @param handle Handle returned when the callback was registered.
+ * @param budget_us Budget in microseconds, 0 to disable.
+ * @param action BNO08xCbBudgetAction::FLAG to only count overruns, BNO08xCbBudgetAction::SKIP to also skip the
+ * invocation following each overrun such that a slow callback cannot saturate its callback queue.
+ *
+ * @return True if budget was set, false if the handle is invalid or its callback was unregistered.
+ */
+bool BNO08x::set_cb_budget(bno08x_cb_handle_t handle, uint32_t budget_us, BNO08xCbBudgetAction action)
+{
+    BNO08xCbGeneric* cb_entry = nullptr;
+
+    xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+    cb_entry = cb_list_lookup(sync_ctx, handle);
+
+    // applied by the callback's dispatcher before its next invocation
+    if (cb_entry != nullptr)
     {
-        sync_ctx.cb_list.push_back(BNO08xCbParamRptID(cb_fxn, 0U));
-        return true;
+        cb_entry->cfg_begin();
+        cb_entry->cfg_pending.budget_us = budget_us;
+        cb_entry->cfg_pending.budget_action = action;
+        cb_entry->cfg_commit();
     }
-    return false;
+
+    xSemaphoreGive(sync_ctx.cb_list_lock);
+
+    return (cb_entry != nullptr);
+}
+
+/**
+ * @brief Decimates a registered callback such that it is only invoked once every decimation samples.
+ *
+ * Only callbacks registered to a single report can be decimated, a callback registered to all reports
+ * (BNO08x::register_cb()) would count the interleaved samples of every report.
+ *
+ * @param handle Handle returned when the callback was registered.
+ * @param decimation Invoke the callback once every decimation samples, 0 or 1 to invoke on every sample.
+ * @param mode BNO08xDecimationMode::LATEST to pass the most recent sample, BNO08xDecimationMode::AVERAGE to pass the
+ * mean of the samples since the last invocation (data callbacks of vector and rotation vector reports only).
+ *
+ * @return True if decimation was set, false if the handle is invalid, its callback was unregistered or is registered
+ * to all reports.
+ */
+bool BNO08x::set_cb_decimation(bno08x_cb_handle_t handle, uint32_t decimation, BNO08xDecimationMode mode)
+{
+    return cb_decimation_update(handle, (decimation == 0UL) ? 1UL : decimation, 0UL, mode);
+}
+
+/**
+ * @brief Decimates a registered callback to a target rate, derived from the period its report was enabled with.
+ *
+ * The decimation follows the report if it is later re-enabled at a different period. Only callbacks registered to a
+ * single report have a period to derive the decimation from.
+ *
+ * @param handle Handle returned when the callback was registered.
+ * @param rate_hz Target invocation rate in Hz, 0 to invoke on every sample.
+ * @param mode BNO08xDecimationMode::LATEST to pass the most recent sample, BNO08xDecimationMode::AVERAGE to pass the
+ * mean of the samples since the last invocation (data callbacks of vector and rotation vector reports only).
+ *
+ * @return True if rate was set, false if the handle is invalid, its callback was unregistered or is registered to
+ * all reports, or rate_hz is negative, NaN or too low for its period to fit in 32 bits of microseconds.
+ */
+bool BNO08x::set_cb_rate(bno08x_cb_handle_t handle, float rate_hz, BNO08xDecimationMode mode)
+{
+    static const constexpr float PERIOD_MAX_US = static_cast<float>(UINT32_MAX);
+    float period_us = 0.0f;
+
+    // NaN fails every comparison, rates so low their period does not fit target_period_us are rejected as well
+    if (!(rate_hz >= 0.0f))
+        return false;
+
+    if (rate_hz != 0.0f)
+    {
+        period_us = 1000000.0f / rate_hz;
+
+        if (period_us >= PERIOD_MAX_US)
+        {
+            // clang-format off
+            #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+            ESP_LOGE(TAG, "Callback rate failed, rate is too low to be represented as a period.");
+            #endif
+            // clang-format on
+
+            return false;
+        }
+    }
+
+    return cb_decimation_update(handle, 1UL, static_cast<uint32_t>(period_us), mode);
+}
+
+/**
+ * @brief Publishes new decimation settings of a registered callback, applied by its dispatcher before the next
+ * invocation such that decimation_cnt is never written concurrently with dispatch().
+ *
+ * @param handle Handle returned when the callback was registered.
+ * @param decimation Invoke the callback once every decimation samples.
+ * @param target_period_us If non 0, decimation is derived from the report's period instead.
+ * @param mode Sample passed to the callback when decimated.
+ *
+ * @return True if the settings were published, false if the handle is invalid, its callback was unregistered or is
+ * registered to all reports.
+ */
+bool BNO08x::cb_decimation_update(
+        bno08x_cb_handle_t handle, uint32_t decimation, uint32_t target_period_us, BNO08xDecimationMode mode)
+{
+    BNO08xCbGeneric* cb_entry = nullptr;
+    bool success = false;
+
+    xSemaphoreTake(sync_ctx.cb_list_lock, portMAX_DELAY);
+
+    cb_entry = cb_list_lookup(sync_ctx, handle);
+
+    // callbacks registered to all reports carry report ID 0
+    if ((cb_entry != nullptr) && (cb_entry->rpt_ID != 0U))
+    {
+        cb_entry->cfg_begin();
+        cb_entry->cfg_pending.decimation = decimation;
+        cb_entry->cfg_pending.target_period_us = target_period_us;
+        cb_entry->cfg_pending.decimation_mode = mode;
+        cb_entry->cfg_commit();
+        success = true;
+    }
+
+    xSemaphoreGive(sync_ctx.cb_list_lock);
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    if ((cb_entry != nullptr) && !success)
+        ESP_LOGE(TAG, "Callback decimation failed, callbacks registered to all reports cannot be decimated.");
+    #endif
+    // clang-format on
+
+    return success;
 }
 
 /**
@@ -2060,7 +3323,8 @@ bool BNO08x::get_system_orientation(float& Qw, float& Qx, float& Qy, float& Qz)
 /**
  * @brief HINT interrupt service routine, handles falling edge of BNO08x HINT pin.
  *
- * ISR that launches SPI task to perform transaction upon assertion of BNO08x interrupt pin.
+ * ISR that wakes the task owning the SPI transport (see bno08x_hint_route_t) to perform a transaction upon
+ * assertion of BNO08x interrupt pin.
  *
  * @return void, nothing to return
  */
@@ -2069,8 +3333,23 @@ void IRAM_ATTR BNO08x::hint_handler(void* arg)
     BaseType_t xHighPriorityTaskWoken = pdFALSE;
     BNO08x* imu = (BNO08x*) arg; // cast argument received by gpio_isr_handler_add ("this" pointer
                                  // to imu object created by constructor call)
+    bno08x_hint_route_t& route = imu->sync_ctx.hint_route;
+    TaskHandle_t owner = route.owner;
+
+    route.hint_us = static_cast<uint32_t>(esp_timer_get_time()); // sh2 HAL lib timestamps the next read with this
+
+    // wake the task that owns the SPI transport directly, no deferral to the timer service task
+    // sh2_HAL_service_task() is not woken while it spins on the HINT level
+    if (owner == route.service_task)
+    {
+        if ((owner != NULL) && !route.polling)
+            vTaskNotifyGiveIndexedFromISR(owner, HINT_NOTIFY_INDEX, &xHighPriorityTaskWoken);
+    }
+    else if (owner != NULL)
+    {
+        // user task calling a driver API, its own task notifications are left untouched
+        xSemaphoreGiveFromISR(route.sem_hint, &xHighPriorityTaskWoken);
+    }
 
-    // notify any tasks/function calls waiting for HINT assertion
-    xEventGroupSetBitsFromISR(imu->sync_ctx.evt_grp_task, EVT_GRP_BNO08x_TASK_HINT_ASSRT_BIT, &xHighPriorityTaskWoken);
     portYIELD_FROM_ISR(xHighPriorityTaskWoken); // perform context switch if necessary
 }
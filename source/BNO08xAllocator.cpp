@@ -0,0 +1,146 @@
+/**
+ * @file BNO08xAllocator.cpp
+ * @author Myles Parfeniuk
+ */
+
+#include "BNO08xAllocator.hpp"
+
+/**
+ * @brief BNO08xHeapAllocator constructor.
+ *
+ * @param hot_caps Heap capabilities used for BNO08xMemRegion::HOT storage.
+ * @param bulk_caps Heap capabilities used for BNO08xMemRegion::BULK storage, falls back to hot_caps if exhausted.
+ *
+ * @return void, nothing to return
+ */
+BNO08xHeapAllocator::BNO08xHeapAllocator(uint32_t hot_caps, uint32_t bulk_caps)
+    : hot_caps(hot_caps)
+    , bulk_caps(bulk_caps)
+{
+}
+
+/**
+ * @brief Allocates a block from the heap with the capabilities of the requested region.
+ *
+ * @param size Size of the block in bytes.
+ * @param alignment Required alignment of the block in bytes, a power of 2.
+ * @param region Memory region the block should be placed in.
+ *
+ * @return Pointer to the block, nullptr if out of memory.
+ */
+void* BNO08xHeapAllocator::allocate(size_t size, size_t alignment, BNO08xMemRegion region)
+{
+    void* ptr = nullptr;
+
+    if (region == BNO08xMemRegion::BULK)
+        ptr = heap_caps_aligned_alloc(alignment, size, bulk_caps);
+
+    // bulk region may be absent (ex. no PSRAM), hot storage is always acceptable
+    if (ptr == nullptr)
+        ptr = heap_caps_aligned_alloc(alignment, size, hot_caps);
+
+    return ptr;
+}
+
+/**
+ * @brief Returns a block to the heap.
+ *
+ * @param ptr The block to release.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xHeapAllocator::deallocate(void* ptr)
+{
+    heap_caps_free(ptr);
+}
+
+/**
+ * @brief Returns the allocator used by BNO08x objects constructed without an allocator.
+ *
+ * @return Heap allocator with default capabilities.
+ */
+BNO08xHeapAllocator& BNO08xHeapAllocator::default_allocator()
+{
+    static BNO08xHeapAllocator allocator;
+
+    return allocator;
+}
+
+/**
+ * @brief BNO08xArenaAllocator constructor.
+ *
+ * @param buffer Storage the arena allocates from, must outlive every BNO08x object using the arena.
+ * @param size Size of buffer in bytes.
+ *
+ * @return void, nothing to return
+ */
+BNO08xArenaAllocator::BNO08xArenaAllocator(void* buffer, size_t size)
+    : buffer(static_cast<uint8_t*>(buffer))
+    , size(size)
+    , offset(0U)
+{
+}
+
+/**
+ * @brief Allocates a block from the arena.
+ *
+ * @param size Size of the block in bytes.
+ * @param alignment Required alignment of the block in bytes, a power of 2.
+ * @param region Ignored, the arena occupies a single region.
+ *
+ * @return Pointer to the block, nullptr if the arena is exhausted.
+ */
+void* BNO08xArenaAllocator::allocate(size_t size, size_t alignment, BNO08xMemRegion region)
+{
+    uintptr_t start = reinterpret_cast<uintptr_t>(buffer) + offset;
+    size_t padding = (alignment - (start & (alignment - 1U))) & (alignment - 1U);
+
+    if ((buffer == nullptr) || ((this->size - offset) < (padding + size)))
+        return nullptr;
+
+    offset += padding + size;
+
+    return reinterpret_cast<void*>(start + padding);
+}
+
+/**
+ * @brief Does nothing, arena blocks are released all at once with reclaim().
+ *
+ * @param ptr The block to release.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xArenaAllocator::deallocate(void* ptr)
+{
+}
+
+/**
+ * @brief Releases every block allocated from the arena, only call once every BNO08x object using the arena has been
+ * destroyed.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xArenaAllocator::reclaim()
+{
+    offset = 0U;
+}
+
+/**
+ * @brief Returns the amount of the arena in use, including alignment padding.
+ *
+ * @return Bytes used.
+ */
+size_t BNO08xArenaAllocator::used() const
+{
+    return offset;
+}
+
+/**
+ * @brief Returns the capacity of the arena.
+ *
+ * @return Size of the arena in bytes.
+ */
+size_t BNO08xArenaAllocator::capacity() const
+{
+    return size;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file BNO08xFrame.cpp
+ * @author Myles Parfeniuk
+ */
+
+#include "BNO08xFrame.hpp"
+#include "BNO08xRpt.hpp"
+
+/**
+ * @brief BNO08xFrameBase constructor.
+ *
+ * @return void, nothing to return
+ */
+BNO08xFrameBase::BNO08xFrameBase()
+    : sync_ctx(nullptr)
+    , member_mask(0UL)
+    , pending_mask(0UL)
+    , pending_timestamp_us(0ULL)
+    , aligned(false)
+    , ready_seq(0UL)
+    , read_seq(0UL)
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    , sem_ready(xSemaphoreCreateBinaryStatic(&sem_ready_buffer))
+    #else
+    , sem_ready(xSemaphoreCreateBinary())
+    #endif
+// clang-format on
+{
+}
+
+/**
+ * @brief BNO08xFrameBase destructor.
+ *
+ * @return void, nothing to return
+ */
+BNO08xFrameBase::~BNO08xFrameBase()
+{
+    disable();
+
+    if (sem_ready != NULL)
+        vSemaphoreDelete(sem_ready);
+}
+
+/**
+ * @brief Waits for a frame newer than the one last returned, then makes it available through get().
+ *
+ * The frame is copied under a single data lock such that all members are from the same delivery.
+ *
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a new frame was received, false if timeout_ms elapsed first or the frame is not enabled.
+ */
+bool BNO08xFrameBase::wait(uint32_t timeout_ms)
+{
+    TimeOut_t timeout;
+    TickType_t ticks_remaining = timeout_ms / portTICK_PERIOD_MS;
+    bool received = false;
+
+    if ((sync_ctx == nullptr) || (sem_ready == NULL))
+        return false;
+
+    vTaskSetTimeOutState(&timeout);
+
+    while (true)
+    {
+        xSemaphoreTake(sync_ctx->data_lock, portMAX_DELAY);
+        if (ready_seq != read_seq)
+        {
+            deliver();
+            read_seq = ready_seq;
+            received = true;
+        }
+        xSemaphoreGive(sync_ctx->data_lock);
+
+        if (received)
+            return true;
+
+        if (xTaskCheckForTimeOut(&timeout, &ticks_remaining) == pdTRUE)
+            return false;
+
+        xSemaphoreTake(sem_ready, ticks_remaining);
+    }
+}
+
+/**
+ * @brief Detaches the frame from its member reports such that it stops collecting samples.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xFrameBase::disable()
+{
+    if (sync_ctx == nullptr)
+        return;
+
+    xSemaphoreTake(sync_ctx->data_lock, portMAX_DELAY);
+    for (BNO08xRpt* rpt : members)
+    {
+        rpt->frame = nullptr;
+        rpt->frame_slot = nullptr;
+    }
+    members.clear();
+    member_mask = 0UL;
+    pending_mask = 0UL;
+    xSemaphoreGive(sync_ctx->data_lock);
+
+    sync_ctx = nullptr;
+}
+
+/**
+ * @brief Attaches the frame to a set of reports, each report writes its samples to its slot.
+ *
+ * @param rpts Member reports.
+ * @param slots Pending sample slot of each member report (bno08x_history_entry_t of the report's sample type).
+ * @param rpt_count Amount of member reports.
+ * @param aligned If true, frames are only published when all members share the same hub timestamp.
+ *
+ * @return True if attached, false if the frame is already enabled, a report is repeated, or a report is already
+ * part of another frame.
+ */
+bool BNO08xFrameBase::attach(BNO08xRpt* const* rpts, void* const* slots, size_t rpt_count, bool aligned)
+{
+    EventBits_t mask = 0UL;
+    bool success = true;
+
+    if ((sync_ctx != nullptr) || (rpt_count == 0U) || (sem_ready == NULL))
+        return false;
+
+    xSemaphoreTake(rpts[0]->sync_ctx->data_lock, portMAX_DELAY);
+    for (size_t i = 0; i < rpt_count; i++)
+    {
+        if ((rpts[i]->frame != nullptr) || (mask & rpts[i]->rpt_bit) || (rpts[i]->sync_ctx != rpts[0]->sync_ctx))
+        {
+            success = false;
+            break;
+        }
+
+        mask |= rpts[i]->rpt_bit;
+    }
+
+    if (success)
+    {
+        for (size_t i = 0; i < rpt_count; i++)
+        {
+            rpts[i]->frame = this;
+            rpts[i]->frame_slot = slots[i];
+            members.push_back(rpts[i]);
+        }
+
+        sync_ctx = rpts[0]->sync_ctx;
+        member_mask = mask;
+        pending_mask = 0UL;
+        this->aligned = aligned;
+        read_seq = ready_seq;
+    }
+    xSemaphoreGive(rpts[0]->sync_ctx->data_lock);
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    if (!success)
+        ESP_LOGE(TAG, "Failed to enable frame, member reports must be unique and not part of another frame.");
+    #endif
+    // clang-format on
+
+    return success;
+}
+
+/**
+ * @brief Marks a member as updated and publishes the frame once all members have updated.
+ *
+ * Called from data_proc_task() with user data locked, after the member wrote its sample to its slot.
+ *
+ * @param rpt_bit Bit of the member report that updated.
+ * @param timestamp_us Timestamp of the member's sample.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xFrameBase::member_updated(EventBits_t rpt_bit, uint64_t timestamp_us)
+{
+    // sample is from a different hub instant than the pending members, restart the frame from this sample
+    if (aligned && (pending_mask != 0UL) && (timestamp_us != pending_timestamp_us))
+        pending_mask = 0UL;
+
+    pending_timestamp_us = timestamp_us;
+    pending_mask |= rpt_bit;
+
+    if (pending_mask == member_mask)
+    {
+        publish();
+        pending_mask = 0UL;
+        ready_seq++;
+        xSemaphoreGive(sem_ready);
+    }
+}
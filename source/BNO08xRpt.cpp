@@ -4,23 +4,36 @@
  */
 
 #include "BNO08xRpt.hpp"
+#include "BNO08xFrame.hpp"
 
 /**
  * @brief Enables a sensor report such that the BNO08x begins sending it.
  *
+ * The report is recorded as enabled even if its config is not confirmed in time, such that it is still restored
+ * after a reset.
+ *
  * @param report_period_us The period/interval of the report in microseconds.
  * @param sensor_cfg Sensor special configuration (optional, see
  * BNO08xPrivateTypes::default_sensor_cfg for defaults).
+ * @param await_ack True to wait for the BNO08x to confirm the config, false if the caller awaits it itself (see
+ * BNO08x::configure_reports()).
  *
- * @return True if report was successfully enabled.
+ * @return True if report was successfully enabled, false if the command failed or was not confirmed in time.
  */
-bool BNO08xRpt::rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg)
+bool BNO08xRpt::rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg, bool await_ack)
 {
     int sh2_res = SH2_OK;
     int16_t idx = -1;
+    bool acked = true;
 
+    apply_required_cfg(sensor_cfg);
     sensor_cfg.reportInterval_us = time_between_reports;
 
+    xEventGroupClearBits(sync_ctx->evt_grp_rpt_cfg_ack, rpt_bit);
+
+    // the hub's sequence number is arbitrary on enable and restarts after a reset (re_enable_reports() lands here)
+    seq_resync = true;
+
     lock_sh2_HAL();
     sh2_res = sh2_setSensorConfig(ID, &sensor_cfg);
     unlock_sh2_HAL();
@@ -33,8 +46,9 @@ bool BNO08xRpt::rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sen
     {
         xEventGroupSetBits(sync_ctx->evt_grp_rpt_en, rpt_bit); // set the event group bit
 
-        vTaskDelay(30UL / portTICK_PERIOD_MS); // delay a bit to allow command to execute
-        period_us = time_between_reports;      // update the period
+        if (await_ack)
+            acked = wait_cfg_ack();       // wait for command to execute
+        period_us = time_between_reports; // update the period
 
         lock_user_data();
         for (int i = 0; i < sync_ctx->en_report_ids.size(); i++)
@@ -52,7 +66,14 @@ bool BNO08xRpt::rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sen
 
         unlock_user_data();
 
-        return true;
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        if (!acked)
+            ESP_LOGE(TAG, "Report %d enable was not confirmed within %dms.", ID, CONFIG_ESP32_BNO08X_RPT_CFG_ACK_TIMEOUT_MS);
+        #endif
+        // clang-format on
+
+        return acked;
     }
 }
 
@@ -60,18 +81,35 @@ bool BNO08xRpt::rpt_enable(uint32_t time_between_reports, sh2_SensorConfig_t sen
  * @brief Disables a sensor report by setting its period to 0us such that the BNO08x stops sending
  * it.
  *
- * @param sensor_ID The ID of the sensor for the respective report to be disabled.
  * @param sensor_cfg Sensor special configuration.
  *
- * @return ESP_OK if report was successfully disabled.
+ * @return True if report was successfully disabled, false if the command failed or was not confirmed in time.
  */
 bool BNO08xRpt::disable(sh2_SensorConfig_t sensor_cfg)
+{
+    return rpt_disable(sensor_cfg, true);
+}
+
+/**
+ * @brief Disables a sensor report by setting its period to 0us such that the BNO08x stops sending
+ * it.
+ *
+ * @param sensor_cfg Sensor special configuration.
+ * @param await_ack True to wait for the BNO08x to confirm the config, false if the caller awaits it itself (see
+ * BNO08x::configure_reports()).
+ *
+ * @return True if report was successfully disabled, false if the command failed or was not confirmed in time.
+ */
+bool BNO08xRpt::rpt_disable(sh2_SensorConfig_t sensor_cfg, bool await_ack)
 {
     int sh2_res = SH2_OK;
     int16_t idx = -1;
+    bool acked = true;
 
     sensor_cfg.reportInterval_us = 0UL;
 
+    xEventGroupClearBits(sync_ctx->evt_grp_rpt_cfg_ack, rpt_bit);
+
     lock_sh2_HAL();
     sh2_res = sh2_setSensorConfig(ID, &sensor_cfg);
     unlock_sh2_HAL();
@@ -85,6 +123,9 @@ bool BNO08xRpt::disable(sh2_SensorConfig_t sensor_cfg)
         // clear the event group bit (this is redundant if called from BNO08x::disable_all_reports())
         xEventGroupClearBits(sync_ctx->evt_grp_rpt_en, rpt_bit);
 
+        if (await_ack)
+            acked = wait_cfg_ack(); // wait for command to execute
+
         // remove report ID from enabled report IDs
         lock_user_data();
         for (int i = 0; i < sync_ctx->en_report_ids.size(); i++)
@@ -96,8 +137,7 @@ bool BNO08xRpt::disable(sh2_SensorConfig_t sensor_cfg)
             }
         }
 
-        vTaskDelay(30UL / portTICK_PERIOD_MS); // delay a bit to allow command to execute
-        period_us = 0UL;                       // update the period
+        period_us = 0UL; // update the period
 
         if (idx != -1)
             sync_ctx->en_report_ids.erase(sync_ctx->en_report_ids.begin() + idx);
@@ -105,24 +145,55 @@ bool BNO08xRpt::disable(sh2_SensorConfig_t sensor_cfg)
         unlock_user_data();
     }
 
-    return true;
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    if (!acked)
+        ESP_LOGE(TAG, "Report %d disable was not confirmed within %dms.", ID, CONFIG_ESP32_BNO08X_RPT_CFG_ACK_TIMEOUT_MS);
+    #endif
+    // clang-format on
+
+    return acked;
+}
+
+/**
+ * @brief Applies sensor config fields a report requires regardless of the user's config, before it is enabled.
+ *
+ * Reports without such fields keep the user's config as is.
+ *
+ * @param sensor_cfg Sensor config about to be sent to the BNO08x.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::apply_required_cfg(sh2_SensorConfig_t& sensor_cfg)
+{
+}
+
+/**
+ * @brief Waits for the BNO08x to confirm the most recent set feature command sent for this report.
+ *
+ * The BNO08x answers every set feature command with a Get Feature Response once it has been applied, replacing the
+ * fixed delay previously used after each command.
+ *
+ * @return True if the config was confirmed, false if RPT_CFG_ACK_TIMEOUT_TICKS elapsed first.
+ */
+bool BNO08xRpt::wait_cfg_ack()
+{
+    return (xEventGroupWaitBits(sync_ctx->evt_grp_rpt_cfg_ack, rpt_bit, pdFALSE, pdTRUE, RPT_CFG_ACK_TIMEOUT_TICKS) &
+                   rpt_bit) != 0UL;
 }
 
 /**
  * @brief Registers a callback to execute when new data from a specific report is received.
  *
  * @param cb_fxn Pointer to the call-back function should be of void return type void input param.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within data_proc_task().
  *
- * @return void, nothing to return
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
  */
-bool BNO08xRpt::register_cb(std::function<void(void)> cb_fxn)
+bno08x_cb_handle_t BNO08xRpt::register_cb(BNO08xCbFunction<void(void)> cb_fxn, BNO08xCbExec exec)
 {
-    if (sync_ctx->cb_list.size() < CONFIG_ESP32_BNO08X_CB_MAX)
-    {
-        sync_ctx->cb_list.push_back(BNO08xCbParamVoid(cb_fxn, ID));
-        return true;
-    }
-    return false;
+    return BNO08xPrivateTypes::cb_list_register(*sync_ctx,
+            (exec == BNO08xCbExec::INLINE) ? cb_list_inline_head : cb_list_head, BNO08xCbParamVoid(cb_fxn, ID));
 }
 
 /**
@@ -228,6 +299,204 @@ bool BNO08xRpt::get_meta_data(bno08x_meta_data_t& meta_data)
     return (success == SH2_OK);
 }
 
+/**
+ * @brief Sets the action taken when this report's callback events do not fit in the callback queue.
+ *
+ * @param policy The overload policy, BNO08xOverloadPolicy::DROP_NEWEST by default.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::set_overload_policy(BNO08xOverloadPolicy policy)
+{
+    overload_policy = policy;
+}
+
+/**
+ * @brief Returns the action taken when this report's callback events do not fit in the callback queue.
+ *
+ * @return The current overload policy.
+ */
+BNO08xOverloadPolicy BNO08xRpt::get_overload_policy()
+{
+    return overload_policy;
+}
+
+/**
+ * @brief Returns counts of samples lost for this report.
+ *
+ * Counters are incremented atomically by the driver tasks and can be read at any time without locking.
+ *
+ * @return Struct containing the drop counters.
+ */
+bno08x_rpt_drop_stats_t BNO08xRpt::get_drop_stats()
+{
+    return drop_stats;
+}
+
+/**
+ * @brief Resets counts of samples lost for this report to 0.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::clear_drop_stats()
+{
+    drop_stats = bno08x_rpt_drop_stats_t();
+}
+
+/**
+ * @brief Returns the bit representing this report in masks passed to and returned from wait_for().
+ *
+ * @return The report bit, OR multiple together to build a mask.
+ */
+EventBits_t BNO08xRpt::get_rpt_bit()
+{
+    return rpt_bit;
+}
+
+/**
+ * @brief Moves this report to a different processing lane, only while the report is disabled.
+ *
+ * Moving an enabled report would let both lanes' data_proc_task() process its samples concurrently. Samples still
+ * queued in the previous lane are discarded by it, as the report is disabled.
+ *
+ * @param lane BNO08xLane::HIGH for latency sensitive reports, BNO08xLane::LOW for reports that may be delayed.
+ *
+ * @return True if the report was moved, false if the report is enabled.
+ */
+bool BNO08xRpt::set_lane(BNO08xLane lane)
+{
+    if (rpt_bit & xEventGroupGetBits(sync_ctx->evt_grp_rpt_en))
+    {
+        // clang-format off
+        #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+        ESP_LOGE(TAG, "Failed to set lane, report must be disabled first.");
+        #endif
+        // clang-format on
+
+        return false;
+    }
+
+    this->lane = lane;
+    return true;
+}
+
+/**
+ * @brief Returns the processing lane of this report.
+ *
+ * @return The current lane.
+ */
+BNO08xLane BNO08xRpt::get_lane()
+{
+    return lane;
+}
+
+/**
+ * @brief Assigns this report to a callback worker, reports on different workers execute their callbacks in parallel.
+ *
+ * Callbacks of a single report always execute in order on one worker. Callbacks registered to all reports
+ * (BNO08x::register_cb()) always execute on worker 0, such that they never execute concurrently. Callback events
+ * already queued to the previous worker are still executed by it.
+ *
+ * @param worker Index of the worker, 0 to CONFIG_ESP32_BNO08X_CB_WORKER_COUNT - 1.
+ *
+ * @return True if the report was assigned, false if worker is out of range.
+ */
+bool BNO08xRpt::set_cb_worker(uint8_t worker)
+{
+    if (worker >= CONFIG_ESP32_BNO08X_CB_WORKER_COUNT)
+        return false;
+
+    cb_worker = worker;
+    return true;
+}
+
+/**
+ * @brief Returns the callback worker this report is assigned to.
+ *
+ * @return Index of the worker.
+ */
+uint8_t BNO08xRpt::get_cb_worker()
+{
+    return cb_worker;
+}
+
+/**
+ * @brief Stops recording samples into the history buffer passed to enable_history(), releasing it.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::disable_history()
+{
+    lock_user_data();
+    history_buf = nullptr;
+    history_depth = 0U;
+    unlock_user_data();
+}
+
+/**
+ * @brief Claims a waiter such that data_proc_task() writes the next sample of this report to entry.
+ *
+ * @param entry Destination of the sample, bno08x_history_entry_t of this report's sample type.
+ *
+ * @return The claimed waiter, nullptr if all CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX waiters are in use.
+ */
+BNO08xPrivateTypes::bno08x_next_waiter_t* BNO08xRpt::next_waiter_claim(void* entry)
+{
+    BNO08xPrivateTypes::bno08x_next_waiter_t* claimed = nullptr;
+
+    lock_user_data();
+    for (BNO08xPrivateTypes::bno08x_next_waiter_t& waiter : sync_ctx->next_waiters)
+    {
+        if (!waiter.in_use)
+        {
+            waiter.in_use = true;
+            xSemaphoreTake(waiter.sem_delivered, 0); // drop a give left over from a timed out wait
+            waiter.entry = entry;
+            waiter.delivered = false;
+            waiter.rpt = this;
+            next_waiter_cnt++;
+            claimed = &waiter;
+            break;
+        }
+    }
+    unlock_user_data();
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    if (claimed == nullptr)
+        ESP_LOGE(TAG, "get_next() failed, all %d waiters in use.", CONFIG_ESP32_BNO08X_NEXT_WAITER_MAX);
+    #endif
+    // clang-format on
+
+    return claimed;
+}
+
+/**
+ * @brief Releases a waiter claimed with next_waiter_claim(), withdrawing it from delivery if no sample arrived.
+ *
+ * @param waiter The waiter to release.
+ *
+ * @return True if a sample was delivered to the waiter.
+ */
+bool BNO08xRpt::next_waiter_release(BNO08xPrivateTypes::bno08x_next_waiter_t* waiter)
+{
+    bool delivered = false;
+
+    lock_user_data();
+    delivered = waiter->delivered;
+
+    if (!delivered)
+    {
+        waiter->rpt = nullptr;
+        next_waiter_cnt--;
+    }
+
+    waiter->in_use = false;
+    unlock_user_data();
+
+    return delivered;
+}
+
 /**
  * @brief Locks sh2 HAL lib to only allow the calling task to call its APIs.
  *
@@ -236,6 +505,7 @@ bool BNO08xRpt::get_meta_data(bno08x_meta_data_t& meta_data)
 void BNO08xRpt::lock_sh2_HAL()
 {
     xSemaphoreTake(sync_ctx->sh2_HAL_lock, portMAX_DELAY);
+    sync_ctx->hint_route.claim();
 }
 
 /**
@@ -245,6 +515,7 @@ void BNO08xRpt::lock_sh2_HAL()
  */
 void BNO08xRpt::unlock_sh2_HAL()
 {
+    sync_ctx->hint_route.release();
     xSemaphoreGive(sync_ctx->sh2_HAL_lock);
 }
 
@@ -269,12 +540,148 @@ void BNO08xRpt::unlock_user_data()
 }
 
 /**
- * @brief Signals to BNO08x::data_available() that a new report has arrived.
+ * @brief Signals to BNO08x::data_available() and any interested subscribers that a new report has arrived.
  *
  * @return void, nothing to return
  */
 void BNO08xRpt::signal_data_available()
 {
+    seq++;
+
+    for (BNO08xSubscriber& subscriber : sync_ctx->subscribers)
+        subscriber.notify(rpt_bit);
+
+    // previous sample was never consumed with has_new_data()
+    if (xEventGroupGetBits(sync_ctx->evt_grp_rpt_data_available) & rpt_bit)
+        BNO08xPrivateTypes::drop_stat_inc(drop_stats.overwritten);
+
     xEventGroupSetBits(sync_ctx->evt_grp_rpt_data_available, rpt_bit);
     xEventGroupSetBits(sync_ctx->evt_grp_task, BNO08xPrivateTypes::EVT_GRP_BNO08x_TASK_DATA_AVAILABLE);
 }
+
+
+/**
+ * @brief Executes BNO08xCbExec::INLINE callbacks registered to all reports, followed by those registered to this
+ * report.
+ *
+ * Called from data_proc_task() with user data unlocked, such that inline callbacks may call getters.
+ *
+ * @param rpt_data Pointer to the sample just received.
+ * @param dispatcher Dispatcher index of the calling data_proc_task() instance, see cb_dispatcher_inline().
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::invoke_inline_cbs(const void* rpt_data, uint8_t dispatcher)
+{
+    BNO08xPrivateTypes::cb_dispatch_begin(*sync_ctx, dispatcher);
+
+    for (BNO08xCbGeneric* cb_entry = sync_ctx->cb_list_inline_head; cb_entry != nullptr; cb_entry = cb_entry->next)
+        cb_entry->dispatch(ID, rpt_data, period_us);
+
+    for (BNO08xCbGeneric* cb_entry = cb_list_inline_head; cb_entry != nullptr; cb_entry = cb_entry->next)
+        cb_entry->dispatch(ID, rpt_data, period_us);
+
+    BNO08xPrivateTypes::cb_dispatch_end(*sync_ctx, dispatcher);
+}
+
+/**
+ * @brief Sends a copy of the most recent sample to the cb_task() workers of the callbacks interested in this report.
+ *
+ * Callbacks registered to this report execute on its worker, callbacks registered to all reports on
+ * CB_WORKER_GLOBAL. A single event covers both if this report is assigned to CB_WORKER_GLOBAL.
+ *
+ * @param rpt_data Pointer to the sample to send.
+ * @param rpt_data_sz Size of the sample in bytes.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::signal_cb(const void* rpt_data, size_t rpt_data_sz)
+{
+    BNO08xPrivateTypes::bno08x_cb_evt_t cb_evt;
+    const bool rpt_cbs = (cb_list_head != nullptr);
+    const bool global_cbs = (sync_ctx->cb_list_head != nullptr);
+
+    if (!rpt_cbs && !global_cbs)
+        return;
+
+    cb_evt.rpt = this;
+    memcpy(cb_evt.rpt_data, rpt_data, rpt_data_sz);
+
+    if (cb_worker == BNO08xPrivateTypes::CB_WORKER_GLOBAL)
+    {
+        cb_evt.scope = BNO08xPrivateTypes::CB_EVT_SCOPE_GLOBAL | BNO08xPrivateTypes::CB_EVT_SCOPE_RPT;
+        send_cb_evt(cb_worker, cb_evt);
+        return;
+    }
+
+    if (rpt_cbs)
+    {
+        cb_evt.scope = BNO08xPrivateTypes::CB_EVT_SCOPE_RPT;
+        send_cb_evt(cb_worker, cb_evt);
+    }
+
+    if (global_cbs)
+    {
+        cb_evt.scope = BNO08xPrivateTypes::CB_EVT_SCOPE_GLOBAL;
+        send_cb_evt(BNO08xPrivateTypes::CB_WORKER_GLOBAL, cb_evt);
+    }
+}
+
+/**
+ * @brief Sends a callback event to a cb_task() worker, applying this report's overload policy if its queue is full.
+ *
+ * @param worker_idx Index of the worker to send to.
+ * @param cb_evt The callback event to send.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::send_cb_evt(uint8_t worker_idx, const BNO08xPrivateTypes::bno08x_cb_evt_t& cb_evt)
+{
+    BNO08xPrivateTypes::bno08x_cb_evt_t evicted_cb_evt;
+    TickType_t send_timeout = (overload_policy == BNO08xOverloadPolicy::BLOCK) ? CB_QUEUE_BLOCK_TIMEOUT_TICKS : 0;
+    BNO08xPrivateTypes::bno08x_cb_worker_t& worker = sync_ctx->cb_workers[worker_idx];
+    QueueHandle_t queue_cb_evt = (lane == BNO08xLane::LOW) ? worker.queue_cb_evt_low : worker.queue_cb_evt;
+
+    if (xQueueSend(queue_cb_evt, &cb_evt, send_timeout) == pdTRUE)
+    {
+        xSemaphoreGive(worker.sem_cb_evt);
+        return;
+    }
+
+    if (overload_policy == BNO08xOverloadPolicy::DROP_OLDEST)
+    {
+        // evict oldest pending event to make room (cb_task() may have already made room in the meantime)
+        if (xQueueReceive(queue_cb_evt, &evicted_cb_evt, 0) == pdTRUE)
+            if (evicted_cb_evt.rpt != nullptr)
+            {
+                // the evicted event may belong to a report of the other lane, whose data_proc_task() counts too
+                BNO08xPrivateTypes::drop_stat_inc(evicted_cb_evt.rpt->drop_stats.cb_queue);
+                BNO08xPrivateTypes::drop_stat_inc(sync_ctx->drop_stats.cb_queue);
+            }
+
+        if (xQueueSend(queue_cb_evt, &cb_evt, 0) == pdTRUE)
+        {
+            xSemaphoreGive(worker.sem_cb_evt);
+            return;
+        }
+    }
+
+    BNO08xPrivateTypes::drop_stat_inc(drop_stats.cb_queue);
+    BNO08xPrivateTypes::drop_stat_inc(sync_ctx->drop_stats.cb_queue);
+
+    // clang-format off
+    #ifdef CONFIG_ESP32_BNO08x_LOG_STATEMENTS
+    ESP_LOGE(TAG, "Callback queue full, callback execution for report missed.");
+    #endif
+    // clang-format on
+}
+
+/**
+ * @brief Notifies the frame this report is a member of that its slot was written, called with user data locked.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRpt::frame_updated()
+{
+    frame->member_updated(rpt_bit, timestamp_us);
+}
@@ -27,7 +27,9 @@ void BNO08xSH2HAL::set_hal_imu(BNO08x* hal_imu)
  */
 int BNO08xSH2HAL::spi_open(sh2_Hal_t* self)
 {
-    spi_wait_for_int();
+    // the IMU was just reset and must assert HINT, there is no data to lose by resetting it again
+    if (imu->wait_for_hint() != ESP_OK)
+        hardware_reset();
 
     return 0;
 }
@@ -49,7 +51,7 @@ void BNO08xSH2HAL::spi_close(sh2_Hal_t* self)
  * @param self sh2 HAL lib object being used with BNO08x driver instance.
  * @param pBuffer Buffer to store received packet.
  * @param len Length of bytes to read.
- * @param t_us Time in microseconds (unused, forced sh2 HAL lib required function type)
+ * @param t_us Time in microseconds HINT was asserted for this packet, used by sh2 HAL lib to timestamp sensor events.
  *
  * @return Size of received packet in bytes, 0 on failure.
  */
@@ -61,6 +63,8 @@ int BNO08xSH2HAL::spi_read(sh2_Hal_t* self, uint8_t* pBuffer, unsigned len, uint
     if (!spi_wait_for_int())
         return 0;
 
+    *t_us = imu->sync_ctx.hint_route.hint_us;
+
     // assert chip select
     gpio_set_level(imu->imu_config.io_cs, 0);
 
@@ -91,8 +95,20 @@ int BNO08xSH2HAL::spi_read(sh2_Hal_t* self, uint8_t* pBuffer, unsigned len, uint
  */
 int BNO08xSH2HAL::spi_write(sh2_Hal_t* self, uint8_t* pBuffer, unsigned len)
 {
+    bool hint_asserted = false;
+
+    // request an immediate HINT instead of waiting for the next report, the BNO08x asserts HINT once awake
+    if (imu->imu_config.io_wake != GPIO_NUM_NC)
+        gpio_set_level(imu->imu_config.io_wake, 0);
+
+    hint_asserted = spi_wait_for_int();
+
+    // WAKE may be deasserted as soon as HINT is asserted
+    if (imu->imu_config.io_wake != GPIO_NUM_NC)
+        gpio_set_level(imu->imu_config.io_wake, 1);
+
     // hint never asserted, fail transaction
-    if (!spi_wait_for_int())
+    if (!hint_asserted)
         return 0;
 
     // setup transaction to send packet
@@ -141,7 +157,48 @@ uint32_t BNO08xSH2HAL::get_time_us(sh2_Hal_t* self)
 void BNO08xSH2HAL::hal_cb(void* cookie, sh2_AsyncEvent_t* pEvent)
 {
     if (pEvent->eventId == SH2_RESET)
+    {
+        BNO08xPrivateTypes::bno08x_reset_tracker_t& tracker = imu->sync_ctx.reset_tracker;
+        bno08x_reset_log_entry_t entry;
+        int64_t time_us = esp_timer_get_time();
+
+        entry.timestamp_us = time_us;
+
+        imu->lock_user_data();
+
+        // data stopped at the last sample if reports were running, otherwise measure from detection
+        if ((tracker.last_sample_us != 0LL) && (xEventGroupGetBits(imu->sync_ctx.evt_grp_rpt_en) != 0UL))
+            tracker.outage_start_us = tracker.last_sample_us;
+        else
+            tracker.outage_start_us = time_us;
+
+        tracker.reset_detected_us = time_us;
+        tracker.first_sample_us = 0LL;
+        tracker.awaiting_sample = true;
+        tracker.entry_incomplete = false; // entry of a previous reset never received a sample, leave its downtime 0
+
+        // logged once here, BNO08x::recover_from_reset() may be retried until the configs are restored
+        tracker.log.push(entry);
+        tracker.reset_count++;
+        tracker.entry_pending = true;
+
+        imu->unlock_user_data();
+
         xEventGroupSetBits(imu->sync_ctx.evt_grp_task, BNO08xPrivateTypes::EVT_GRP_BNO08x_TASK_RESET_OCCURRED);
+
+        // sh2_HAL_service_task() only wakes on task notifications, it restores the configs lost to the reset
+        if (imu->sync_ctx.hint_route.service_task != NULL)
+            xTaskNotifyGiveIndexed(imu->sync_ctx.hint_route.service_task, BNO08xPrivateTypes::HINT_NOTIFY_INDEX);
+    }
+
+    // sent by the BNO08x once a set feature command has been applied, confirms the report's new config
+    if (pEvent->eventId == SH2_GET_FEATURE_RESP)
+    {
+        auto rpt = imu->usr_reports.find(pEvent->sh2SensorConfigResp.sensorId);
+
+        if ((rpt != imu->usr_reports.end()) && (rpt->second != nullptr))
+            xEventGroupSetBits(imu->sync_ctx.evt_grp_rpt_cfg_ack, rpt->second->get_rpt_bit());
+    }
 }
 
 /**
@@ -154,7 +211,22 @@ void BNO08xSH2HAL::hal_cb(void* cookie, sh2_AsyncEvent_t* pEvent)
  */
 void BNO08xSH2HAL::sensor_event_cb(void* cookie, sh2_SensorEvent_t* event)
 {
-    xQueueSend(imu->queue_rx_sensor_event, event, 0);
+    auto rpt = imu->usr_reports.find(event->reportId);
+    QueueHandle_t queue_rx = imu->queue_rx_sensor_event;
+    BNO08xPrivateTypes::bno08x_reset_tracker_t& tracker = imu->sync_ctx.reset_tracker;
+
+    tracker.last_sample_us = esp_timer_get_time();
+
+    // first sample since a reset, ends its downtime
+    if (tracker.awaiting_sample)
+        imu->reset_recovered(tracker.last_sample_us);
+
+    // route to the lane of the report, unimplemented reports are dropped by data_proc_task()
+    if ((rpt != imu->usr_reports.end()) && (rpt->second != nullptr) && (rpt->second->get_lane() == BNO08xLane::LOW))
+        queue_rx = imu->queue_rx_sensor_event_low;
+
+    if (xQueueSend(queue_rx, event, 0) != pdTRUE)
+        BNO08xPrivateTypes::drop_stat_inc(imu->sync_ctx.drop_stats.rx_queue);
 }
 
 /**
@@ -170,15 +242,19 @@ void BNO08xSH2HAL::hardware_reset()
 /**
  * @brief SPI wait for HINT sh2 HAL lib callback.
  *
+ * Timeouts are escalated by BNO08x::wait_for_hint_recover(), the IMU is only hard reset once it is considered stuck.
+ *
  * @return True if interrupt was detected before timeout.
  */
 bool BNO08xSH2HAL::spi_wait_for_int()
 {
-    if (imu->wait_for_hint() != ESP_OK)
-    {
+    esp_err_t ret = imu->wait_for_hint_recover();
+
+    if (ret == ESP_FAIL)
         hardware_reset();
+
+    if (ret != ESP_OK)
         return false;
-    }
 
     return true;
 }
@@ -0,0 +1,193 @@
+/**
+ * @file BNO08xSubscriber.cpp
+ * @author Myles Parfeniuk
+ */
+
+#include "BNO08xSubscriber.hpp"
+#include "BNO08xRpt.hpp"
+
+/**
+ * @brief Subscribes to a report such that data_available() is woken when it is received.
+ *
+ * Only updates received after this call are reported by has_new_data().
+ *
+ * @param rpt The report to subscribe to, ex. imu.rpt.accelerometer.
+ *
+ * @return True if subscription was success, false if this subscriber has been destroyed.
+ */
+bool BNO08xSubscriber::subscribe(BNO08xRpt& rpt)
+{
+    uint8_t slot = rpt_slot(rpt.rpt_bit);
+
+    if (!in_use)
+        return false;
+
+    rpts[slot] = &rpt;
+    cursors[slot] = rpt.seq;
+    // set last and atomically such that data_proc_task() never wakes on a partially initialized slot or a torn mask
+    __atomic_fetch_or(&rpt_mask, rpt.rpt_bit, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/**
+ * @brief Unsubscribes from a report such that it no longer wakes data_available().
+ *
+ * @param rpt The report to unsubscribe from.
+ *
+ * @return True if unsubscription was success, false if this subscriber has been destroyed.
+ */
+bool BNO08xSubscriber::unsubscribe(BNO08xRpt& rpt)
+{
+    if (!in_use)
+        return false;
+
+    __atomic_fetch_and(&rpt_mask, ~rpt.rpt_bit, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/**
+ * @brief Waits for any subscribed report to be received that has not yet been consumed with has_new_data().
+ *
+ * Does not consume the update, other subscribers are unaffected.
+ *
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a subscribed report has new data, false if timeout_ms elapsed first.
+ */
+bool BNO08xSubscriber::data_available(uint32_t timeout_ms)
+{
+    TimeOut_t timeout;
+    TickType_t ticks_remaining = timeout_ms / portTICK_PERIOD_MS;
+
+    if (!in_use)
+        return false;
+
+    vTaskSetTimeOutState(&timeout);
+
+    // sem_wake may hold a stale give for an update that was already consumed, so always re-check the cursors
+    while (pending_bits(rpt_mask) == 0UL)
+    {
+        if (xTaskCheckForTimeOut(&timeout, &ticks_remaining) == pdTRUE)
+            return false;
+
+        xSemaphoreTake(sem_wake, ticks_remaining);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks if a subscribed report has been received since the last time this subscriber called this
+ * function for it.
+ *
+ * @param rpt The report to check, ex. imu.rpt.accelerometer.
+ *
+ * @return True if a new report was received, false if not or this subscriber is not subscribed to rpt.
+ */
+bool BNO08xSubscriber::has_new_data(BNO08xRpt& rpt)
+{
+    uint8_t slot = rpt_slot(rpt.rpt_bit);
+    uint32_t seq = rpt.seq;
+
+    if (!(rpt_mask & rpt.rpt_bit))
+        return false;
+
+    if (seq == cursors[slot])
+        return false;
+
+    cursors[slot] = seq;
+    return true;
+}
+
+/**
+ * @brief Waits until any or all of a set of subscribed reports have received new data.
+ *
+ * Reports that caused the return are consumed, as if has_new_data() was called on them. Other subscribers are
+ * unaffected.
+ *
+ * @param wait_mask Reports to wait for, built by OR'ing BNO08xRpt::get_rpt_bit() of each report. Reports this
+ * subscriber is not subscribed to are ignored.
+ * @param mode BNO08xWaitMode::ANY to return on the first update, BNO08xWaitMode::ALL to wait for every report.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return Mask of reports that updated, 0 if timeout_ms elapsed first.
+ */
+EventBits_t BNO08xSubscriber::wait_for(EventBits_t wait_mask, BNO08xWaitMode mode, uint32_t timeout_ms)
+{
+    TimeOut_t timeout;
+    TickType_t ticks_remaining = timeout_ms / portTICK_PERIOD_MS;
+    EventBits_t updated = 0UL;
+
+    wait_mask &= rpt_mask;
+
+    if (!in_use || (wait_mask == 0UL))
+        return 0UL;
+
+    vTaskSetTimeOutState(&timeout);
+
+    while (true)
+    {
+        updated = pending_bits(wait_mask);
+
+        if ((mode == BNO08xWaitMode::ANY) ? (updated != 0UL) : (updated == wait_mask))
+            break;
+
+        if (xTaskCheckForTimeOut(&timeout, &ticks_remaining) == pdTRUE)
+            return 0UL;
+
+        xSemaphoreTake(sem_wake, ticks_remaining);
+    }
+
+    for (uint8_t slot = 0; slot < RPT_SLOT_COUNT; slot++)
+        if (updated & (1UL << slot))
+            cursors[slot] = rpts[slot]->seq;
+
+    return updated;
+}
+
+/**
+ * @brief Finds which reports in a mask have a sequence number ahead of this subscriber's cursor.
+ *
+ * @param wait_mask Reports to check, must only contain subscribed reports.
+ *
+ * @return Mask of reports with unconsumed data.
+ */
+EventBits_t BNO08xSubscriber::pending_bits(EventBits_t wait_mask)
+{
+    EventBits_t pending = 0UL;
+
+    for (uint8_t slot = 0; slot < RPT_SLOT_COUNT; slot++)
+        if ((wait_mask & (1UL << slot)) && (rpts[slot]->seq != cursors[slot]))
+            pending |= (1UL << slot);
+
+    return pending;
+}
+
+/**
+ * @brief Wakes data_available() and wait_for() if this subscriber is subscribed to the report that was just received.
+ *
+ * Called from data_proc_task().
+ *
+ * @param rpt_bit Bit of the received report in bno08x_rpt_bit_t.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xSubscriber::notify(EventBits_t rpt_bit)
+{
+    if (__atomic_load_n(&rpt_mask, __ATOMIC_ACQUIRE) & rpt_bit)
+        xSemaphoreGive(sem_wake);
+}
+
+/**
+ * @brief Converts a report bit to its cursor slot index.
+ *
+ * @param rpt_bit Bit of the report in bno08x_rpt_bit_t.
+ *
+ * @return Index of the report's slot in rpts and cursors.
+ */
+uint8_t BNO08xSubscriber::rpt_slot(EventBits_t rpt_bit)
+{
+    return static_cast<uint8_t>(__builtin_ctz(rpt_bit));
+}
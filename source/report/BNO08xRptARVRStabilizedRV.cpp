@@ -17,8 +17,9 @@ void BNO08xRptARVRStabilizedRV::update_data(sh2_SensorValue_t* sensor_val)
     lock_user_data();
     data = sensor_val->un.arvrStabilizedRV;
     data.accuracy = static_cast<BNO08xAccuracy>(sensor_val->status);
+    stamp_sample(data);
     unlock_user_data();
 
     if (rpt_bit & xEventGroupGetBits(sync_ctx->evt_grp_rpt_en))
-        signal_data_available();
+        signal_data_available(data);
 }
\ No newline at end of file
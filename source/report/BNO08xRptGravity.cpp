@@ -17,10 +17,11 @@ void BNO08xRptGravity::update_data(sh2_SensorValue_t* sensor_val)
     lock_user_data();
     data = sensor_val->un.gravity;
     data.accuracy = static_cast<BNO08xAccuracy>(sensor_val->status);
+    stamp_sample(data);
     unlock_user_data();
 
     if (rpt_bit & xEventGroupGetBits(sync_ctx->evt_grp_rpt_en))
-        signal_data_available();
+        signal_data_available(data);
 }
 
 /**
@@ -48,4 +49,61 @@ bno08x_accel_t BNO08xRptGravity::get()
     bno08x_accel_t rqdata = data;
     unlock_user_data();
     return rqdata;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Registers a callback to execute when new gravity data is received, the received sample is
+ * passed directly to the callback such that it does not need to be retrieved with a getter.
+ *
+ * @param cb_fxn Pointer to the call-back function should be of void return type with single input
+ * param of const bno08x_accel_t& for the received sample.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within data_proc_task().
+ *
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08xRptGravity::register_cb(BNO08xCbFunction<void(const bno08x_accel_t& data)> cb_fxn, BNO08xCbExec exec)
+{
+    return register_cb_data<bno08x_accel_t>(cb_fxn, exec);
+}
+
+/**
+ * @brief Enables recording of every received gravity sample, along with its timestamp, into a user provided
+ * ring buffer such that samples are not lost between reads.
+ *
+ * @param buf Storage for the history, its size is the history depth. Must outlive the report or be released
+ * with disable_history().
+ *
+ * @return True if history was enabled.
+ */
+bool BNO08xRptGravity::enable_history(etl::span<bno08x_history_entry_t<bno08x_accel_t>> buf)
+{
+    return history_enable<bno08x_accel_t>(buf);
+}
+
+/**
+ * @brief Copies every gravity sample recorded since cursor into span, under a single data lock.
+ *
+ * @param cursor Sequence number of the next sample to read, start at 0, advanced past the copied samples.
+ * @param span Destination for the copied samples, oldest first.
+ *
+ * @return Amount of samples copied into span.
+ */
+size_t BNO08xRptGravity::read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_accel_t>> span)
+{
+    return history_read_since<bno08x_accel_t>(cursor, span);
+}
+
+/**
+ * @brief Blocks the calling task until the next gravity sample is received.
+ *
+ * The task is only woken by this report, samples of other reports do not wake it.
+ *
+ * @param sample Struct to store the sample and its timestamp.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a sample was received, false if timeout_ms elapsed first or too many tasks are waiting.
+ */
+bool BNO08xRptGravity::get_next(bno08x_history_entry_t<bno08x_accel_t>& sample, uint32_t timeout_ms)
+{
+    return next_sample<bno08x_accel_t>(sample, timeout_ms);
+}
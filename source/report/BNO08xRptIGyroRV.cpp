@@ -17,11 +17,13 @@ void BNO08xRptIGyroRV::update_data(sh2_SensorValue_t* sensor_val)
     lock_user_data();
     data = sensor_val->un.gyroIntegratedRV;
     data.accuracy = static_cast<BNO08xAccuracy>(sensor_val->status);
+    stamp_sample(data);
     data_vel = sensor_val->un.gyroIntegratedRV;
+    stamp_sample(data_vel);
     unlock_user_data();
 
     if (rpt_bit & xEventGroupGetBits(sync_ctx->evt_grp_rpt_en))
-        signal_data_available();
+        signal_data_available(etl::make_pair(data, data_vel));
 }
 
 /**
@@ -52,4 +54,63 @@ bno08x_ang_vel_t BNO08xRptIGyroRV::get_vel()
     bno08x_ang_vel_t rqdata = data_vel;
     unlock_user_data();
     return rqdata;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Registers a callback to execute when new gyro integrated rotation vector data is received, the received sample is
+ * passed directly to the callback such that it does not need to be retrieved with a getter.
+ *
+ * @param cb_fxn Pointer to the call-back function should be of void return type with input params
+ * of const bno08x_quat_t& and const bno08x_ang_vel_t& for the received sample.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within data_proc_task().
+ *
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08xRptIGyroRV::register_cb(BNO08xCbFunction<void(const bno08x_quat_t& quat, const bno08x_ang_vel_t& vel)> cb_fxn, BNO08xCbExec exec)
+{
+    return register_cb_data<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>(
+            [cb_fxn](const etl::pair<bno08x_quat_t, bno08x_ang_vel_t>& sample) { cb_fxn(sample.first, sample.second); },
+            exec);
+}
+
+/**
+ * @brief Enables recording of every received gyro integrated rotation vector sample, along with its timestamp, into a user provided
+ * ring buffer such that samples are not lost between reads.
+ *
+ * @param buf Storage for the history, its size is the history depth. Must outlive the report or be released
+ * with disable_history().
+ *
+ * @return True if history was enabled.
+ */
+bool BNO08xRptIGyroRV::enable_history(etl::span<bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>> buf)
+{
+    return history_enable<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>(buf);
+}
+
+/**
+ * @brief Copies every gyro integrated rotation vector sample recorded since cursor into span, under a single data lock.
+ *
+ * @param cursor Sequence number of the next sample to read, start at 0, advanced past the copied samples.
+ * @param span Destination for the copied samples, oldest first.
+ *
+ * @return Amount of samples copied into span.
+ */
+size_t BNO08xRptIGyroRV::read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>> span)
+{
+    return history_read_since<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>(cursor, span);
+}
+
+/**
+ * @brief Blocks the calling task until the next gyro integrated rotation vector sample is received.
+ *
+ * The task is only woken by this report, samples of other reports do not wake it.
+ *
+ * @param sample Struct to store the sample and its timestamp.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a sample was received, false if timeout_ms elapsed first or too many tasks are waiting.
+ */
+bool BNO08xRptIGyroRV::get_next(bno08x_history_entry_t<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>& sample, uint32_t timeout_ms)
+{
+    return next_sample<etl::pair<bno08x_quat_t, bno08x_ang_vel_t>>(sample, timeout_ms);
+}
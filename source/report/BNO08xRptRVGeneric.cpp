@@ -95,3 +95,60 @@ bool BNO08xRptRVGeneric::tare(bool x, bool y, bool z, sh2_TareBasis_t basis)
     else
         return true;
 }
+
+/**
+ * @brief Registers a callback to execute when new rotation vector data is received, the received sample is
+ * passed directly to the callback such that it does not need to be retrieved with a getter.
+ *
+ * @param cb_fxn Pointer to the call-back function should be of void return type with single input
+ * param of const bno08x_quat_t& for the received sample.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within data_proc_task().
+ *
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08xRptRVGeneric::register_cb(BNO08xCbFunction<void(const bno08x_quat_t& data)> cb_fxn, BNO08xCbExec exec)
+{
+    return register_cb_data<bno08x_quat_t>(cb_fxn, exec);
+}
+
+/**
+ * @brief Enables recording of every received rotation vector sample, along with its timestamp, into a user provided
+ * ring buffer such that samples are not lost between reads.
+ *
+ * @param buf Storage for the history, its size is the history depth. Must outlive the report or be released
+ * with disable_history().
+ *
+ * @return True if history was enabled.
+ */
+bool BNO08xRptRVGeneric::enable_history(etl::span<bno08x_history_entry_t<bno08x_quat_t>> buf)
+{
+    return history_enable<bno08x_quat_t>(buf);
+}
+
+/**
+ * @brief Copies every rotation vector sample recorded since cursor into span, under a single data lock.
+ *
+ * @param cursor Sequence number of the next sample to read, start at 0, advanced past the copied samples.
+ * @param span Destination for the copied samples, oldest first.
+ *
+ * @return Amount of samples copied into span.
+ */
+size_t BNO08xRptRVGeneric::read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_quat_t>> span)
+{
+    return history_read_since<bno08x_quat_t>(cursor, span);
+}
+
+/**
+ * @brief Blocks the calling task until the next rotation vector sample is received.
+ *
+ * The task is only woken by this report, samples of other reports do not wake it.
+ *
+ * @param sample Struct to store the sample and its timestamp.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a sample was received, false if timeout_ms elapsed first or too many tasks are waiting.
+ */
+bool BNO08xRptRVGeneric::get_next(bno08x_history_entry_t<bno08x_quat_t>& sample, uint32_t timeout_ms)
+{
+    return next_sample<bno08x_quat_t>(sample, timeout_ms);
+}
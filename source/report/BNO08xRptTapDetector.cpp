@@ -16,11 +16,21 @@
  * @return True if report was successfully enabled.
  */
 bool BNO08xRptTapDetector::enable(uint32_t time_between_reports, sh2_SensorConfig_t sensor_cfg)
+{
+    return BNO08xRpt::rpt_enable(time_between_reports, sensor_cfg);
+}
+
+/**
+ * @brief Applies the sensor config fields tap detector reports require regardless of the user's config.
+ *
+ * @param sensor_cfg Sensor config about to be sent to the BNO08x.
+ *
+ * @return void, nothing to return
+ */
+void BNO08xRptTapDetector::apply_required_cfg(sh2_SensorConfig_t& sensor_cfg)
 {
     sensor_cfg.changeSensitivityEnabled = true; // this must be set regardless of user cfg or no reports will be received
     sensor_cfg.changeSensitivity = 0U;          // this must be set regardless of user cfg or no reports will be received
-
-    return BNO08xRpt::rpt_enable(time_between_reports, sensor_cfg);
 }
 
 /**
@@ -35,10 +45,12 @@ void BNO08xRptTapDetector::update_data(sh2_SensorValue_t* sensor_val)
     lock_user_data();
     data = sensor_val->un.tapDetector;
     data.accuracy = static_cast<BNO08xAccuracy>(sensor_val->status);
+    stamp_sample(data);
+    event_push(events, data);
     unlock_user_data();
 
     if (rpt_bit & xEventGroupGetBits(sync_ctx->evt_grp_rpt_en))
-        signal_data_available();
+        signal_data_available(data);
 }
 
 /**
@@ -52,4 +64,74 @@ bno08x_tap_detector_t BNO08xRptTapDetector::get()
     bno08x_tap_detector_t rqdata = data;
     unlock_user_data();
     return rqdata;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Registers a callback to execute when new tap detector data is received, the received sample is
+ * passed directly to the callback such that it does not need to be retrieved with a getter.
+ *
+ * @param cb_fxn Pointer to the call-back function should be of void return type with single input
+ * param of const bno08x_tap_detector_t& for the received sample.
+ * @param exec BNO08xCbExec::DEFERRED to execute on cb_task(), BNO08xCbExec::INLINE to execute within data_proc_task().
+ *
+ * @return Handle to the callback, used to unregister it, invalid if registration failed.
+ */
+bno08x_cb_handle_t BNO08xRptTapDetector::register_cb(BNO08xCbFunction<void(const bno08x_tap_detector_t& data)> cb_fxn, BNO08xCbExec exec)
+{
+    return register_cb_data<bno08x_tap_detector_t>(cb_fxn, exec);
+}
+
+/**
+ * @brief Enables recording of every received tap detector sample, along with its timestamp, into a user provided
+ * ring buffer such that samples are not lost between reads.
+ *
+ * @param buf Storage for the history, its size is the history depth. Must outlive the report or be released
+ * with disable_history().
+ *
+ * @return True if history was enabled.
+ */
+bool BNO08xRptTapDetector::enable_history(etl::span<bno08x_history_entry_t<bno08x_tap_detector_t>> buf)
+{
+    return history_enable<bno08x_tap_detector_t>(buf);
+}
+
+/**
+ * @brief Copies every tap detector sample recorded since cursor into span, under a single data lock.
+ *
+ * @param cursor Sequence number of the next sample to read, start at 0, advanced past the copied samples.
+ * @param span Destination for the copied samples, oldest first.
+ *
+ * @return Amount of samples copied into span.
+ */
+size_t BNO08xRptTapDetector::read_since(uint32_t& cursor, etl::span<bno08x_history_entry_t<bno08x_tap_detector_t>> span)
+{
+    return history_read_since<bno08x_tap_detector_t>(cursor, span);
+}
+
+/**
+ * @brief Blocks the calling task until the next tap detector sample is received.
+ *
+ * The task is only woken by this report, samples of other reports do not wake it.
+ *
+ * @param sample Struct to store the sample and its timestamp.
+ * @param timeout_ms Max time to wait in milliseconds.
+ *
+ * @return True if a sample was received, false if timeout_ms elapsed first or too many tasks are waiting.
+ */
+bool BNO08xRptTapDetector::get_next(bno08x_history_entry_t<bno08x_tap_detector_t>& sample, uint32_t timeout_ms)
+{
+    return next_sample<bno08x_tap_detector_t>(sample, timeout_ms);
+}
+
+/**
+ * @brief Pops the oldest tap detector event that has not yet been returned, such that events which arrive in quick
+ * succession are not lost when the application reads them late.
+ *
+ * @param evt Struct to store the popped event and its timestamp.
+ *
+ * @return True if an event was popped, false if no events are pending.
+ */
+bool BNO08xRptTapDetector::pop_event(bno08x_event_t<bno08x_tap_detector_t>& evt)
+{
+    return event_pop<bno08x_tap_detector_t>(events, evt);
+}
@@ -465,3 +465,108 @@ TEST_CASE("BNO08x Driver Cleanup for [CallbackSingleReportVoidInputParam] Tests"
     BNO08xTestHelper::destroy_test_imu();
     BNO08xTestHelper::print_test_end_banner(TEST_TAG);
 }
+
+TEST_CASE("BNO08x Driver Creation for [CallbackSingleReportDataInputParam] Tests", "[CallbackSingleReportDataInputParam]")
+{
+    const constexpr char* TEST_TAG = "BNO08x Driver Creation for [CallbackSingleReportDataInputParam] Tests";
+
+    BNO08x* imu = nullptr;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    BNO08xTestHelper::print_test_msg(TEST_TAG, "Creating & initializing BNO08x driver.");
+    BNO08xTestHelper::create_test_imu();
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // ensure IMU initialized successfully
+    TEST_ASSERT_EQUAL(true, imu->initialize());
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Single Report Data Input Param Flavor Cb", "[CallbackSingleReportDataInputParam]")
+{
+    const constexpr char* TEST_TAG = "Single Report Data Input Param Flavor Cb";
+    static const constexpr uint8_t ENABLED_REPORT_COUNT = 2;
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = ENABLED_REPORT_COUNT * 5;
+    constexpr uint32_t REPORT_PERIOD = 60000UL; // 60ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bool data_available_cal_gyro = false;
+    bool data_available_uncal_gyro = false;
+    bool rpt_ID_mismatch = false;
+    bool test_running = true;
+    int i = 0;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // report ID flavor registered to all reports, ensures data carrying callbacks are only executed for their own report
+    imu->register_cb(
+            [&rpt_ID_mismatch](uint8_t rpt_ID)
+            {
+                if ((rpt_ID != SH2_GYROSCOPE_CALIBRATED) && (rpt_ID != SH2_GYROSCOPE_UNCALIBRATED))
+                    rpt_ID_mismatch = true;
+            });
+
+    imu->rpt.cal_gyro.register_cb(
+            [&imu, &i, &data_available_cal_gyro, &msg_buff, &test_running](const bno08x_gyro_t& data_vel)
+            {
+                if (i < RX_REPORT_TRIAL_CNT)
+                {
+                    data_available_cal_gyro = true;
+                    sprintf(msg_buff,
+                            "Rx Data Trial %d Success: CalGyro: [rad/s] x: %.2f y: %.2f z: "
+                            "%.2f accuracy: %s ",
+                            (i + 1), data_vel.x, data_vel.y, data_vel.z, BNO08xAccuracy_to_str(data_vel.accuracy));
+                    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+                    i++;
+                }
+                else if (test_running)
+                {
+                    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+                    test_running = false;
+                }
+            });
+
+    imu->rpt.uncal_gyro.register_cb(
+            [&i, &data_available_uncal_gyro, &msg_buff](const bno08x_gyro_t& data_vel, const bno08x_gyro_bias_t& data_bias)
+            {
+                if (i < RX_REPORT_TRIAL_CNT)
+                {
+                    data_available_uncal_gyro = true;
+                    sprintf(msg_buff,
+                            "Rx Data Trial %d Success: UncalGyro: [rad/s] x: %.2f y: %.2f z: %.2f drift x: %.2f y: "
+                            "%.2f z: %.2f ",
+                            (i + 1), data_vel.x, data_vel.y, data_vel.z, data_bias.x, data_bias.y, data_bias.z);
+                    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+                    i++;
+                }
+            });
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.uncal_gyro.enable(REPORT_PERIOD));
+
+    while (test_running)
+    {
+    }
+
+    TEST_ASSERT_EQUAL(true, data_available_cal_gyro);
+    TEST_ASSERT_EQUAL(true, data_available_uncal_gyro);
+    TEST_ASSERT_EQUAL(false, rpt_ID_mismatch);
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("BNO08x Driver Cleanup for [CallbackSingleReportDataInputParam] Tests", "[CallbackSingleReportDataInputParam]")
+{
+    const constexpr char* TEST_TAG = "BNO08x Driver Cleanup for [CallbackSingleReportDataInputParam] Tests";
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, "Destroying BNO08x Driver.");
+
+    BNO08xTestHelper::destroy_test_imu();
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
@@ -338,6 +338,1319 @@ TEST_CASE("Get Sample Counts", "[FeatureTests]")
     BNO08xTestHelper::print_test_end_banner(TEST_TAG);
 }
 
+TEST_CASE("Get Drop Stats", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Get Drop Stats";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_drop_stats_t drop_stats;
+    bno08x_rpt_drop_stats_t rpt_drop_stats;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    imu->clear_drop_stats();
+    imu->rpt.accelerometer.clear_drop_stats();
+    imu->rpt.accelerometer.set_overload_policy(BNO08xOverloadPolicy::DROP_OLDEST);
+    TEST_ASSERT_EQUAL(BNO08xOverloadPolicy::DROP_OLDEST, imu->rpt.accelerometer.get_overload_policy());
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    // let samples pile up without reading them such that some are overwritten
+    vTaskDelay((REPORT_PERIOD * RX_REPORT_TRIAL_CNT * 2UL) / 1000UL / portTICK_PERIOD_MS);
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    drop_stats = imu->get_drop_stats();
+    rpt_drop_stats = imu->rpt.accelerometer.get_drop_stats();
+
+    sprintf(msg_buff, "rx_queue: %ld decode: %ld rpt_disabled: %ld cb_queue: %ld", drop_stats.rx_queue, drop_stats.decode,
+            drop_stats.rpt_disabled, drop_stats.cb_queue);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    sprintf(msg_buff, "accelerometer overwritten: %ld cb_queue: %ld", rpt_drop_stats.overwritten, rpt_drop_stats.cb_queue);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_NOT_EQUAL(0UL, rpt_drop_stats.overwritten);
+
+    imu->clear_drop_stats();
+    imu->rpt.accelerometer.clear_drop_stats();
+    rpt_drop_stats = imu->rpt.accelerometer.get_drop_stats();
+    TEST_ASSERT_EQUAL(0UL, rpt_drop_stats.overwritten);
+    TEST_ASSERT_EQUAL(0UL, rpt_drop_stats.cb_queue);
+
+    imu->rpt.accelerometer.set_overload_policy(BNO08xOverloadPolicy::DROP_NEWEST);
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Multiple Subscribers", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Multiple Subscribers";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    constexpr uint32_t REPORT_PERIOD = 60000UL; // 60ms
+
+    BNO08x* imu = nullptr;
+    BNO08xSubscriber* sub_a = nullptr;
+    BNO08xSubscriber* sub_b = nullptr;
+    char msg_buff[200] = {};
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    sub_a = imu->create_subscriber();
+    sub_b = imu->create_subscriber();
+    TEST_ASSERT_NOT_EQUAL(nullptr, sub_a);
+    TEST_ASSERT_NOT_EQUAL(nullptr, sub_b);
+
+    TEST_ASSERT_EQUAL(true, sub_a->subscribe(imu->rpt.accelerometer));
+    TEST_ASSERT_EQUAL(true, sub_b->subscribe(imu->rpt.accelerometer));
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        // consuming an update with one subscriber must not hide it from the other
+        TEST_ASSERT_EQUAL(true, sub_a->data_available());
+        TEST_ASSERT_EQUAL(true, sub_a->has_new_data(imu->rpt.accelerometer));
+        TEST_ASSERT_EQUAL(true, sub_b->data_available());
+        TEST_ASSERT_EQUAL(true, sub_b->has_new_data(imu->rpt.accelerometer));
+        sprintf(msg_buff, "Rx Data Trial %d Success: both subscribers saw update", (i + 1));
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    TEST_ASSERT_EQUAL(true, imu->destroy_subscriber(sub_a));
+    TEST_ASSERT_EQUAL(true, imu->destroy_subscriber(sub_b));
+    TEST_ASSERT_EQUAL(false, imu->destroy_subscriber(sub_b));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Wait For Report Set", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Wait For Report Set";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    constexpr uint32_t ACCEL_REPORT_PERIOD = 20000UL; // 20ms
+    constexpr uint32_t GYRO_REPORT_PERIOD = 60000UL;  // 60ms
+
+    BNO08x* imu = nullptr;
+    BNO08xSubscriber* sub = nullptr;
+    EventBits_t rpt_mask = 0UL;
+    EventBits_t updated = 0UL;
+    char msg_buff[200] = {};
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+    rpt_mask = imu->rpt.accelerometer.get_rpt_bit() | imu->rpt.cal_gyro.get_rpt_bit();
+
+    sub = imu->create_subscriber();
+    TEST_ASSERT_NOT_EQUAL(nullptr, sub);
+    TEST_ASSERT_EQUAL(true, sub->subscribe(imu->rpt.accelerometer));
+    TEST_ASSERT_EQUAL(true, sub->subscribe(imu->rpt.cal_gyro));
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(ACCEL_REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(GYRO_REPORT_PERIOD));
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        updated = imu->wait_for(rpt_mask, BNO08xWaitMode::ALL);
+        TEST_ASSERT_EQUAL(rpt_mask, updated);
+
+        updated = sub->wait_for(rpt_mask, BNO08xWaitMode::ALL);
+        TEST_ASSERT_EQUAL(rpt_mask, updated);
+
+        updated = imu->wait_for(rpt_mask, BNO08xWaitMode::ANY);
+        TEST_ASSERT_NOT_EQUAL(0UL, updated);
+        TEST_ASSERT_EQUAL(0UL, updated & ~rpt_mask);
+
+        sprintf(msg_buff, "Rx Data Trial %d Success: ANY mode updated mask: 0x%lx", (i + 1), updated);
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    TEST_ASSERT_EQUAL(true, imu->destroy_subscriber(sub));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Report History", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Report History";
+    static const constexpr size_t HISTORY_DEPTH = 32U;
+    static const constexpr size_t READ_SZ = 25U;
+    constexpr uint32_t REPORT_PERIOD = 2000UL; // 2ms
+    constexpr uint32_t READ_PERIOD_MS = 50UL;
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    static bno08x_history_entry_t<bno08x_accel_t> history[HISTORY_DEPTH];
+    static bno08x_history_entry_t<bno08x_accel_t> samples[READ_SZ];
+    uint32_t cursor = 0UL;
+    size_t sample_cnt = 0U;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable_history(history));
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    // discard anything recorded while the report was starting up
+    vTaskDelay(READ_PERIOD_MS / portTICK_PERIOD_MS);
+    while (imu->rpt.accelerometer.read_since(cursor, samples) != 0U)
+    {
+    }
+
+    vTaskDelay(READ_PERIOD_MS / portTICK_PERIOD_MS);
+    sample_cnt = imu->rpt.accelerometer.read_since(cursor, samples);
+
+    sprintf(msg_buff, "Read %d samples after %ldms, cursor: %ld", static_cast<int>(sample_cnt), READ_PERIOD_MS, cursor);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_GREATER_THAN(1U, sample_cnt);
+
+    // samples are returned oldest first
+    for (size_t i = 1; i < sample_cnt; i++)
+        TEST_ASSERT_TRUE(samples[i - 1].timestamp_us < samples[i].timestamp_us);
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    imu->rpt.accelerometer.disable_history();
+    TEST_ASSERT_EQUAL(0U, imu->rpt.accelerometer.read_since(cursor, samples));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Detector Event Queue", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Detector Event Queue";
+    constexpr uint32_t REPORT_PERIOD = 100000UL; // 100ms
+    constexpr uint32_t WAKE_DELAY_MS = 500UL;
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_event_t<bno08x_stability_classifier_t> evt;
+    uint64_t prev_timestamp_us = 0ULL;
+    uint8_t evt_cnt = 0U;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // drain anything left over from previous tests
+    while (imu->rpt.stability_classifier.pop_event(evt))
+    {
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.stability_classifier.enable(REPORT_PERIOD));
+
+    // wake late, every event received in the meantime should still be available
+    vTaskDelay(WAKE_DELAY_MS / portTICK_PERIOD_MS);
+
+    while (imu->rpt.stability_classifier.pop_event(evt))
+    {
+        TEST_ASSERT_TRUE(evt.timestamp_us > prev_timestamp_us);
+        prev_timestamp_us = evt.timestamp_us;
+        evt_cnt++;
+
+        sprintf(msg_buff, "Event %d: stability: %s", evt_cnt, BNO08xStability_to_str(evt.data.stability));
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    TEST_ASSERT_GREATER_THAN(0U, evt_cnt);
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Report Frames", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Report Frames";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    static const constexpr uint8_t ALIGNED_WAIT_CNT = 50; // waits allowed to collect RX_REPORT_TRIAL_CNT aligned frames
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    int aligned_cnt = 0;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    BNO08xFrame<BNO08xRptGameRV, BNO08xRptLinearAcceleration, BNO08xRptCalGyro> frame(
+            imu->rpt.rv_game, imu->rpt.linear_accelerometer, imu->rpt.cal_gyro);
+    BNO08xFrame<BNO08xRptCalGyro> duplicate_frame(imu->rpt.cal_gyro);
+
+    TEST_ASSERT_EQUAL(true, frame.enable());
+    // reports can only be a member of one frame at a time
+    TEST_ASSERT_EQUAL(false, duplicate_frame.enable());
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.rv_game.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.linear_accelerometer.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, frame.wait());
+        sprintf(msg_buff, "Rx Frame Trial %d Success: timestamps [us] rv_game: %lld lin_accel: %lld cal_gyro: %lld", (i + 1),
+                frame.get<0>().timestamp_us, frame.get<1>().timestamp_us, frame.get<2>().timestamp_us);
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    // aligned frames must be received, and only ever contain samples from the same hub instant
+    frame.disable();
+    TEST_ASSERT_EQUAL(true, frame.enable(true));
+
+    for (int i = 0; (i < ALIGNED_WAIT_CNT) && (aligned_cnt < RX_REPORT_TRIAL_CNT); i++)
+    {
+        if (frame.wait())
+        {
+            TEST_ASSERT_TRUE(frame.get<0>().timestamp_us == frame.get<1>().timestamp_us);
+            TEST_ASSERT_TRUE(frame.get<0>().timestamp_us == frame.get<2>().timestamp_us);
+            aligned_cnt++;
+        }
+    }
+
+    sprintf(msg_buff, "Rx'd %d aligned frames", aligned_cnt);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    TEST_ASSERT_TRUE(aligned_cnt > 0);
+
+    frame.disable();
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Report Priority Lanes", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Report Priority Lanes";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // motion reports default to the high lane, classifiers/detectors to the low lane
+    TEST_ASSERT_EQUAL(BNO08xLane::HIGH, imu->rpt.accelerometer.get_lane());
+    TEST_ASSERT_EQUAL(BNO08xLane::LOW, imu->rpt.tap_detector.get_lane());
+
+    // reports keep receiving data after moving to the other lane
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.set_lane(BNO08xLane::LOW));
+    TEST_ASSERT_EQUAL(BNO08xLane::LOW, imu->rpt.accelerometer.get_lane());
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    // lanes can only be changed while the report is disabled
+    TEST_ASSERT_EQUAL(false, imu->rpt.accelerometer.set_lane(BNO08xLane::HIGH));
+    TEST_ASSERT_EQUAL(BNO08xLane::LOW, imu->rpt.accelerometer.get_lane());
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+        TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.has_new_data());
+        sprintf(msg_buff, "Rx Low Lane Accelerometer Trial %d Success", (i + 1));
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.set_lane(BNO08xLane::HIGH));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Callback Workers", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Callback Workers";
+    static const constexpr uint32_t RUN_TIME_MS = 1000UL;
+    static const constexpr uint32_t SLOW_CB_MS = 30UL;
+    static const constexpr uint8_t LAST_WORKER = CONFIG_ESP32_BNO08X_CB_WORKER_COUNT - 1;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_cb_handle_t accel_handle;
+    bno08x_cb_handle_t gyro_handle;
+    bno08x_cb_handle_t global_handle;
+    uint32_t accel_cb_cnt = 0;
+    uint32_t gyro_cb_cnt = 0;
+    int64_t accel_last_us = 0;
+    int64_t accel_max_gap_us = 0;
+    bool global_in_cb = false;
+    bool global_concurrent = false;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(false, imu->rpt.accelerometer.set_cb_worker(CONFIG_ESP32_BNO08X_CB_WORKER_COUNT));
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.set_cb_worker(0));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.set_cb_worker(LAST_WORKER));
+    TEST_ASSERT_EQUAL(LAST_WORKER, imu->rpt.cal_gyro.get_cb_worker());
+
+    accel_handle = imu->rpt.accelerometer.register_cb(
+            [&accel_cb_cnt, &accel_last_us, &accel_max_gap_us]()
+            {
+                int64_t now_us = esp_timer_get_time();
+
+                if ((accel_last_us != 0) && ((now_us - accel_last_us) > accel_max_gap_us))
+                    accel_max_gap_us = now_us - accel_last_us;
+
+                accel_last_us = now_us;
+                accel_cb_cnt++;
+            });
+    TEST_ASSERT_EQUAL(true, accel_handle.valid());
+
+    // slow callback, only delays the accelerometer callback if both reports share a worker
+    gyro_handle = imu->rpt.cal_gyro.register_cb(
+            [&gyro_cb_cnt]()
+            {
+                gyro_cb_cnt++;
+                vTaskDelay(SLOW_CB_MS / portTICK_PERIOD_MS);
+            });
+    TEST_ASSERT_EQUAL(true, gyro_handle.valid());
+
+    // triggered by reports on both workers, must never execute concurrently with itself
+    global_handle = imu->register_cb(
+            [&global_in_cb, &global_concurrent]()
+            {
+                if (global_in_cb)
+                    global_concurrent = true;
+
+                global_in_cb = true;
+                int64_t start_us = esp_timer_get_time();
+                while ((esp_timer_get_time() - start_us) < 200LL)
+                {
+                }
+                global_in_cb = false;
+            });
+    TEST_ASSERT_EQUAL(true, global_handle.valid());
+
+    accel_cb_cnt = 0;
+    gyro_cb_cnt = 0;
+    accel_last_us = 0;
+    accel_max_gap_us = 0;
+    global_concurrent = false;
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+
+    vTaskDelay(RUN_TIME_MS / portTICK_PERIOD_MS);
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff,
+            "Callbacks executed: accelerometer (worker 0): %ld max gap: %lldus cal_gyro (worker %d): %ld", accel_cb_cnt,
+            accel_max_gap_us, LAST_WORKER, gyro_cb_cnt);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_TRUE(accel_cb_cnt > 0);
+    TEST_ASSERT_TRUE(gyro_cb_cnt > 0);
+    TEST_ASSERT_EQUAL(false, global_concurrent);
+
+    // clang-format off
+    #if CONFIG_ESP32_BNO08X_CB_WORKER_COUNT > 1
+    // the slow cal_gyro callback is limited to its own worker, accelerometer callbacks keep the report cadence
+    TEST_ASSERT_TRUE(gyro_cb_cnt <= ((RUN_TIME_MS / SLOW_CB_MS) + 1UL));
+    TEST_ASSERT_TRUE(accel_cb_cnt >= ((RUN_TIME_MS * 1000UL / REPORT_PERIOD) * 3UL / 4UL));
+    TEST_ASSERT_TRUE(accel_max_gap_us < (SLOW_CB_MS * 1000LL));
+    #endif
+    // clang-format on
+
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(accel_handle));
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(gyro_handle));
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(global_handle));
+
+    imu->rpt.accelerometer.set_cb_worker(0);
+    imu->rpt.cal_gyro.set_cb_worker(0);
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Max Size Capturing Callback", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Max Size Capturing Callback";
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+    static const constexpr uint32_t RUN_TIME_MS = 200UL;
+
+    // captured by value, fills the callback's inline storage exactly
+    struct capture_t
+    {
+            uint8_t bytes[CONFIG_ESP32_BNO08X_CB_INPLACE_SZ];
+    };
+
+    // the capture fills the callback's inline storage, leaving no room to capture these by reference
+    static volatile uint32_t cb_cnt = 0;
+    static volatile bool captures_intact = true;
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    capture_t capture;
+    bno08x_cb_handle_t cb_handle;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    for (size_t i = 0; i < sizeof(capture.bytes); i++)
+        capture.bytes[i] = static_cast<uint8_t>(i ^ 0xA5U);
+
+    cb_cnt = 0;
+    captures_intact = true;
+
+    // the lambda goes out of scope before it is invoked, only the registered copy of its captures remains
+    {
+        auto cb = [capture]()
+        {
+            for (size_t i = 0; i < sizeof(capture.bytes); i++)
+                if (capture.bytes[i] != static_cast<uint8_t>(i ^ 0xA5U))
+                    captures_intact = false;
+
+            cb_cnt++;
+        };
+        static_assert(sizeof(cb) == CONFIG_ESP32_BNO08X_CB_INPLACE_SZ, "Callback must fill inline storage exactly.");
+
+        cb_handle = imu->rpt.accelerometer.register_cb(cb);
+        TEST_ASSERT_EQUAL(true, cb_handle.valid());
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+    vTaskDelay(RUN_TIME_MS / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff, "%d byte capture callback executed: %ld captures intact: %d", CONFIG_ESP32_BNO08X_CB_INPLACE_SZ,
+            cb_cnt, captures_intact);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_TRUE(cb_cnt > 0);
+    TEST_ASSERT_EQUAL(true, captures_intact);
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(cb_handle));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Inline Callbacks", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Inline Callbacks";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 10;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_cb_handle_t cb_handle;
+    uint32_t inline_cb_cnt = 0;
+    bool inline_cb_in_data_proc_task = true;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    cb_handle = imu->rpt.gravity.register_cb(
+            [&inline_cb_cnt, &inline_cb_in_data_proc_task](const bno08x_accel_t& data)
+            {
+                // inline callbacks execute in data_proc_task(), not on a callback worker
+                if (strcmp(pcTaskGetName(NULL), "bno08x_data_processing_task") != 0)
+                    inline_cb_in_data_proc_task = false;
+
+                inline_cb_cnt++;
+            },
+            BNO08xCbExec::INLINE);
+    TEST_ASSERT_EQUAL(true, cb_handle.valid());
+
+    inline_cb_cnt = 0;
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.gravity.enable(REPORT_PERIOD));
+
+    vTaskDelay((RX_REPORT_TRIAL_CNT * REPORT_PERIOD / 1000UL) / portTICK_PERIOD_MS);
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff, "Inline callbacks executed: %ld", inline_cb_cnt);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_TRUE(inline_cb_cnt > 0);
+    TEST_ASSERT_EQUAL(true, inline_cb_in_data_proc_task);
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(cb_handle));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Callback Stats & Budgets", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Callback Stats & Budgets";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 20;
+    static const constexpr uint32_t CB_BUDGET_US = 1000UL;
+    constexpr uint32_t REPORT_PERIOD = 20000UL; // 20ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_cb_handle_t cb_handle;
+    bno08x_cb_stats_t stats;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // callback that always overruns its budget
+    cb_handle = imu->rpt.linear_accelerometer.register_cb(
+            []()
+            {
+                int64_t start_us = esp_timer_get_time();
+
+                while ((esp_timer_get_time() - start_us) < (2LL * CB_BUDGET_US))
+                {
+                }
+            });
+    TEST_ASSERT_EQUAL(true, cb_handle.valid());
+
+    TEST_ASSERT_EQUAL(false, imu->set_cb_budget(bno08x_cb_handle_t(), CB_BUDGET_US));
+    TEST_ASSERT_EQUAL(true, imu->set_cb_budget(cb_handle, CB_BUDGET_US, BNO08xCbBudgetAction::SKIP));
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.linear_accelerometer.enable(REPORT_PERIOD));
+    vTaskDelay((RX_REPORT_TRIAL_CNT * REPORT_PERIOD / 1000UL) / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    TEST_ASSERT_EQUAL(true, imu->get_cb_stats(cb_handle, stats));
+
+    sprintf(msg_buff, "Callback stats: invocations: %ld skips: %ld overruns: %ld min: %ldus mean: %.1fus max: %ldus",
+            stats.invocations, stats.skips, stats.overruns, stats.min_us, stats.mean_us(), stats.max_us);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_TRUE(stats.invocations > 0);
+    TEST_ASSERT_TRUE(stats.skips > 0);
+    TEST_ASSERT_EQUAL(stats.invocations, stats.overruns);
+    TEST_ASSERT_TRUE(stats.min_us >= CB_BUDGET_US);
+
+    TEST_ASSERT_EQUAL(true, imu->set_cb_budget(cb_handle, 0UL));
+    TEST_ASSERT_EQUAL(true, imu->clear_cb_stats(cb_handle));
+    TEST_ASSERT_EQUAL(true, imu->get_cb_stats(cb_handle, stats));
+    TEST_ASSERT_EQUAL(0, stats.invocations);
+
+    // handles of unregistered callbacks are rejected
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(cb_handle));
+    TEST_ASSERT_EQUAL(false, imu->get_cb_stats(cb_handle, stats));
+    TEST_ASSERT_EQUAL(false, imu->set_cb_budget(cb_handle, CB_BUDGET_US));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Unregister Callbacks At Runtime", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Unregister Callbacks At Runtime";
+    static const constexpr uint32_t SELF_UNREGISTER_CNT = 10UL;
+    static const constexpr uint32_t CHURN_CNT = 3UL * CONFIG_ESP32_BNO08X_CB_MAX;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    size_t cb_count = 0;
+    bno08x_cb_handle_t churn_handle;
+    bno08x_cb_handle_t stale_handle;
+    bno08x_cb_stats_t stats;
+    bno08x_cb_handle_t self_handle;
+    uint32_t self_cb_cnt = 0;
+    uint32_t churn_cb_cnt = 0;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    cb_count = imu->get_cb_count();
+
+    // callback which unregisters itself from within dispatch
+    self_handle = imu->rpt.accelerometer.register_cb(
+            [imu, &self_handle, &self_cb_cnt]()
+            {
+                if (++self_cb_cnt == SELF_UNREGISTER_CNT)
+                    imu->unregister_cb(self_handle);
+            });
+    TEST_ASSERT_EQUAL(true, self_handle.valid());
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    // register and unregister more callbacks than there are slots while the stream is dispatched, slots must be reused
+    for (int i = 0; i < CHURN_CNT; i++)
+    {
+        churn_handle = imu->rpt.accelerometer.register_cb([&churn_cb_cnt]() { churn_cb_cnt++; });
+        TEST_ASSERT_EQUAL(true, churn_handle.valid());
+        // the previous churn callback's slot may have been reused, its handle must not reach the new callback
+        TEST_ASSERT_EQUAL(false, imu->get_cb_stats(stale_handle, stats));
+        TEST_ASSERT_EQUAL(true, imu->get_cb_stats(churn_handle, stats));
+
+        vTaskDelay((2UL * REPORT_PERIOD / 1000UL) / portTICK_PERIOD_MS);
+
+        TEST_ASSERT_EQUAL(true, imu->unregister_cb(churn_handle));
+        TEST_ASSERT_EQUAL(false, imu->unregister_cb(churn_handle));
+        stale_handle = churn_handle;
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff, "self unregistering cb executed: %ld churn cb executed: %ld", self_cb_cnt, churn_cb_cnt);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_EQUAL(SELF_UNREGISTER_CNT, self_cb_cnt);
+    TEST_ASSERT_TRUE(churn_cb_cnt > 0);
+    TEST_ASSERT_EQUAL(false, imu->unregister_cb(self_handle));
+    TEST_ASSERT_EQUAL(cb_count, imu->get_cb_count());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Callback Decimation", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Callback Decimation";
+    static const constexpr uint32_t DECIMATION = 10UL;
+    static const constexpr uint32_t RUN_TIME_MS = 1000UL;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms, 100Hz
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_cb_handle_t full_rate_handle;
+    bno08x_cb_handle_t decimated_handle;
+    bno08x_cb_handle_t averaged_handle;
+    bno08x_cb_handle_t cb_handle;
+    uint32_t full_rate_cnt = 0;
+    uint32_t decimated_cnt = 0;
+    uint32_t averaged_cnt = 0;
+    bool averaged_normalized = true;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    full_rate_handle = imu->rpt.rv_game.register_cb([&full_rate_cnt](const bno08x_quat_t& data) { full_rate_cnt++; });
+    TEST_ASSERT_EQUAL(true, full_rate_handle.valid());
+
+    decimated_handle = imu->rpt.rv_game.register_cb([&decimated_cnt](const bno08x_quat_t& data) { decimated_cnt++; });
+    TEST_ASSERT_EQUAL(true, decimated_handle.valid());
+    TEST_ASSERT_EQUAL(true, imu->set_cb_decimation(decimated_handle, DECIMATION));
+
+    averaged_handle = imu->rpt.rv_game.register_cb(
+            [&averaged_cnt, &averaged_normalized](const bno08x_quat_t& data)
+            {
+                float norm = data.real * data.real + data.i * data.i + data.j * data.j + data.k * data.k;
+
+                // averaged quaternions must remain unit quaternions
+                if ((norm < 0.99f) || (norm > 1.01f))
+                    averaged_normalized = false;
+
+                averaged_cnt++;
+            });
+    TEST_ASSERT_EQUAL(true, averaged_handle.valid());
+    TEST_ASSERT_EQUAL(true, imu->set_cb_rate(averaged_handle, 10.0f, BNO08xDecimationMode::AVERAGE));
+
+    // rates without a representable period are rejected and leave the previous rate in place
+    TEST_ASSERT_EQUAL(false, imu->set_cb_rate(averaged_handle, -1.0f));
+    TEST_ASSERT_EQUAL(false, imu->set_cb_rate(averaged_handle, NAN));
+    TEST_ASSERT_EQUAL(false, imu->set_cb_rate(averaged_handle, 0.0001f));
+
+    // callbacks registered to all reports see interleaved samples of every report and cannot be decimated
+    cb_handle = imu->register_cb([]() {});
+    TEST_ASSERT_EQUAL(true, cb_handle.valid());
+    TEST_ASSERT_EQUAL(false, imu->set_cb_decimation(cb_handle, DECIMATION));
+    TEST_ASSERT_EQUAL(false, imu->set_cb_rate(cb_handle, 10.0f));
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(cb_handle));
+
+    full_rate_cnt = 0;
+    decimated_cnt = 0;
+    averaged_cnt = 0;
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.rv_game.enable(REPORT_PERIOD));
+    vTaskDelay(RUN_TIME_MS / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff, "Callbacks executed: full rate: %ld decimated by %ld: %ld averaged at 10Hz: %ld", full_rate_cnt,
+            DECIMATION, decimated_cnt, averaged_cnt);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_TRUE(decimated_cnt > 0);
+    TEST_ASSERT_TRUE(averaged_cnt > 0);
+    TEST_ASSERT_TRUE(decimated_cnt <= (full_rate_cnt / DECIMATION));
+    TEST_ASSERT_TRUE(averaged_cnt <= (full_rate_cnt / DECIMATION));
+    TEST_ASSERT_EQUAL(true, averaged_normalized);
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(full_rate_handle));
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(decimated_handle));
+    TEST_ASSERT_EQUAL(true, imu->unregister_cb(averaged_handle));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Batch Report Configuration", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Batch Report Configuration";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    static const constexpr int64_t LEGACY_DELAY_US = 30000LL; // fixed delay previously used after each command
+    constexpr uint32_t REPORT_PERIOD = 10000UL;                // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    int64_t start_us = 0;
+    int64_t enable_us = 0;
+    int64_t disable_us = 0;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    start_us = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(true, imu->configure_reports({{&imu->rpt.rv_game, REPORT_PERIOD}, {&imu->rpt.cal_gyro, REPORT_PERIOD},
+                                    {&imu->rpt.accelerometer, REPORT_PERIOD}, {&imu->rpt.gravity, REPORT_PERIOD}}));
+    enable_us = esp_timer_get_time() - start_us;
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+        sprintf(msg_buff, "Rx Data Trial %d Success", (i + 1));
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+    }
+
+    start_us = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    disable_us = esp_timer_get_time() - start_us;
+
+    sprintf(msg_buff, "Configured 4 reports: enable: %lldus disable: %lldus", enable_us, disable_us);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    // all 4 reports must be configured faster than the fixed per report delay alone would allow
+    TEST_ASSERT_TRUE(enable_us < (4LL * LEGACY_DELAY_US));
+    TEST_ASSERT_TRUE(disable_us < (4LL * LEGACY_DELAY_US));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Reset Recovery Log", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Reset Recovery Log";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 5;
+    static const constexpr uint8_t LOG_POLL_CNT = 50;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_reset_log_entry_t log[CONFIG_ESP32_BNO08X_RESET_LOG_SZ];
+    size_t log_count = 0U;
+    uint32_t reset_count = 0UL;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    imu->clear_reset_log();
+    reset_count = imu->get_reset_count();
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+
+    BNO08xTestHelper::print_test_msg(TEST_TAG, "Hard reseting...");
+    TEST_ASSERT_EQUAL(true, imu->hard_reset());
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+
+    // entry is completed by the first sample after the reset
+    for (int i = 0; i < LOG_POLL_CNT; i++)
+    {
+        log_count = imu->get_reset_log(log);
+
+        if ((log_count != 0U) && (log[log_count - 1U].downtime_us != 0UL))
+            break;
+
+        vTaskDelay(10UL / portTICK_PERIOD_MS);
+    }
+
+    TEST_ASSERT_TRUE(imu->get_reset_count() > reset_count);
+    TEST_ASSERT_TRUE(log_count != 0U);
+    TEST_ASSERT_EQUAL(BNO08xResetReason::EXT_RST, log[log_count - 1U].reason);
+    TEST_ASSERT_TRUE(log[log_count - 1U].recovery_us != 0UL);
+    TEST_ASSERT_TRUE(log[log_count - 1U].downtime_us >= log[log_count - 1U].recovery_us);
+
+    sprintf(msg_buff, "Reset logged: recovery: %" PRIu32 "us downtime: %" PRIu32 "us samples lost: %" PRIu32,
+            log[log_count - 1U].recovery_us, log[log_count - 1U].downtime_us, log[log_count - 1U].samples_lost);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    imu->clear_reset_log();
+    TEST_ASSERT_EQUAL(0U, imu->get_reset_log(log));
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Sample Timestamps & Sequence Numbers", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Sample Timestamps & Sequence Numbers";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 10;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+    constexpr uint32_t STAMP_AGE_MAX = 50000UL; // 50ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_accel_t accel;
+    bno08x_accel_t prev_accel;
+    uint32_t stamp_age_us = 0UL;
+    bno08x_quat_t quat;
+    bno08x_euler_angle_t euler;
+    uint32_t rx_cnt = 0UL;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.rv_game.enable(REPORT_PERIOD));
+
+    while (rx_cnt < RX_REPORT_TRIAL_CNT)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+
+        if (imu->rpt.accelerometer.has_new_data())
+        {
+            accel = imu->rpt.accelerometer.get();
+            TEST_ASSERT_TRUE(accel.timestamp_us != 0ULL);
+
+            // stamps are taken from esp_timer at HINT assertion (sh2 extends the lower 32 bits), so they trail now slightly
+            stamp_age_us = static_cast<uint32_t>(esp_timer_get_time()) - static_cast<uint32_t>(accel.timestamp_us);
+            TEST_ASSERT_TRUE(stamp_age_us < STAMP_AGE_MAX);
+
+            if (rx_cnt != 0UL)
+            {
+                // samples are stamped by the hub, not on read
+                TEST_ASSERT_TRUE(accel.timestamp_us > prev_accel.timestamp_us);
+                TEST_ASSERT_TRUE(accel.seq > prev_accel.seq);
+            }
+
+            sprintf(msg_buff, "Accel: seq: %" PRIu32 " timestamp: %lluus age: %" PRIu32 "us", accel.seq, accel.timestamp_us,
+                    stamp_age_us);
+            BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+            prev_accel = accel;
+            rx_cnt++;
+        }
+
+        if (imu->rpt.rv_game.has_new_data())
+        {
+            quat = imu->rpt.rv_game.get_quat();
+            euler = imu->rpt.rv_game.get_euler();
+            TEST_ASSERT_TRUE(quat.timestamp_us != 0ULL);
+
+            // conversions carry the stamp of the sample they were derived from
+            if (euler.seq == quat.seq)
+                TEST_ASSERT_TRUE(euler.timestamp_us == quat.timestamp_us);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Pluggable Allocator", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Pluggable Allocator";
+    static const constexpr size_t ARENA_SZ = 16384U;
+    static const constexpr size_t HISTORY_DEPTH = 16U;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+
+    alignas(8) static uint8_t arena_buffer[ARENA_SZ];
+    BNO08xArenaAllocator arena(arena_buffer, sizeof(arena_buffer));
+    BNO08x* imu = nullptr;
+    BNO08x* arena_imu = nullptr;
+    char msg_buff[200] = {};
+    size_t used_after_construction = 0U;
+    etl::span<bno08x_history_entry_t<bno08x_accel_t>> history;
+    bno08x_history_entry_t<bno08x_accel_t> samples[HISTORY_DEPTH];
+    uint32_t cursor = 0UL;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    // all storage of a driver constructed with an arena comes from the arena, and is reclaimed at once on teardown
+    arena_imu = new BNO08x(bno08x_config_t(), &arena);
+    used_after_construction = arena.used();
+
+    // clang-format off
+    #ifndef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+    TEST_ASSERT_TRUE(used_after_construction != 0U);
+    #endif
+    // clang-format on
+
+    history = arena_imu->allocate<bno08x_history_entry_t<bno08x_accel_t>>(HISTORY_DEPTH);
+    TEST_ASSERT_EQUAL(HISTORY_DEPTH, history.size());
+    TEST_ASSERT_TRUE(arena.used() >= used_after_construction + (HISTORY_DEPTH * sizeof(bno08x_history_entry_t<bno08x_accel_t>)));
+
+    sprintf(msg_buff, "Arena used: construction: %zu bytes with history: %zu bytes", used_after_construction, arena.used());
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    delete arena_imu;
+    arena.reclaim();
+    TEST_ASSERT_EQUAL(0U, arena.used());
+
+    // optional buffers of the running driver come from its allocator
+    imu = BNO08xTestHelper::get_test_imu();
+
+    history = imu->allocate<bno08x_history_entry_t<bno08x_accel_t>>(HISTORY_DEPTH);
+    TEST_ASSERT_EQUAL(HISTORY_DEPTH, history.size());
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable_history(history));
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    vTaskDelay(100UL / portTICK_PERIOD_MS);
+
+    TEST_ASSERT_TRUE(imu->rpt.accelerometer.read_since(cursor, samples) != 0U);
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    imu->rpt.accelerometer.disable_history();
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("HINT Busy-Poll Latency Benchmark", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "HINT Busy-Poll Latency Benchmark";
+    static const constexpr uint16_t RX_REPORT_TRIAL_CNT = 200;
+    constexpr uint32_t REPORT_PERIOD = 2500UL; // 2.5ms
+    const BNO08xHintMode modes[] = {BNO08xHintMode::INTERRUPT, BNO08xHintMode::BUSY_POLL};
+
+    BNO08x* imu = nullptr;
+    BNO08xSubscriber* sub = nullptr;
+    char msg_buff[200] = {};
+    bno08x_accel_t accel;
+    int64_t rx_time_us = 0LL;
+    int64_t latency_us = 0LL;
+    int64_t latency_min_us = 0LL;
+    int64_t latency_max_us = 0LL;
+    double latency_sum = 0.0;
+    double latency_sq_sum = 0.0;
+    double latency_mean = 0.0;
+    uint16_t rx_cnt = 0U;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(BNO08xHintMode::INTERRUPT, imu->get_hint_mode());
+
+    sub = imu->create_subscriber();
+    TEST_ASSERT_NOT_EQUAL(nullptr, sub);
+    TEST_ASSERT_EQUAL(true, sub->subscribe(imu->rpt.accelerometer));
+
+    for (BNO08xHintMode mode : modes)
+    {
+        imu->set_hint_mode(mode);
+        TEST_ASSERT_EQUAL(mode, imu->get_hint_mode());
+
+        latency_min_us = INT64_MAX;
+        latency_max_us = 0LL;
+        latency_sum = 0.0;
+        latency_sq_sum = 0.0;
+        rx_cnt = 0U;
+
+        TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+        while (rx_cnt < RX_REPORT_TRIAL_CNT)
+        {
+            TEST_ASSERT_EQUAL(true, sub->data_available());
+            rx_time_us = esp_timer_get_time();
+
+            if (!sub->has_new_data(imu->rpt.accelerometer))
+                continue;
+
+            // samples are stamped with the HINT time of their read minus the hub's reporting delay
+            accel = imu->rpt.accelerometer.get();
+            latency_us = rx_time_us - static_cast<int64_t>(accel.timestamp_us);
+
+            latency_min_us = (latency_us < latency_min_us) ? latency_us : latency_min_us;
+            latency_max_us = (latency_us > latency_max_us) ? latency_us : latency_max_us;
+            latency_sum += static_cast<double>(latency_us);
+            latency_sq_sum += static_cast<double>(latency_us) * static_cast<double>(latency_us);
+            rx_cnt++;
+        }
+
+        TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+        latency_mean = latency_sum / RX_REPORT_TRIAL_CNT;
+
+        sprintf(msg_buff, "%s: sample latency mean: %.1fus jitter (std dev): %.1fus min: %lldus max: %lldus",
+                BNO08xHintMode_to_str(mode), latency_mean,
+                sqrt((latency_sq_sum / RX_REPORT_TRIAL_CNT) - (latency_mean * latency_mean)), latency_min_us,
+                latency_max_us);
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+        TEST_ASSERT_TRUE(latency_min_us >= 0LL);
+    }
+
+    imu->set_hint_mode(BNO08xHintMode::INTERRUPT);
+    TEST_ASSERT_EQUAL(true, imu->destroy_subscriber(sub));
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Wake Pin Command Latency", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Wake Pin Command Latency";
+    static const constexpr uint8_t CMD_TRIAL_CNT = 5;
+    constexpr uint32_t SLOW_REPORT_PERIOD = 500000UL; // 500ms, the hub only asserts HINT twice a second on its own
+    constexpr uint32_t REPORT_PERIOD = 100000UL;      // 100ms
+    constexpr int64_t WAKE_CMD_LATENCY_MAX_US = 20000LL;
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    int64_t start_us = 0LL;
+    int64_t cmd_us = 0LL;
+    int64_t cmd_max_us = 0LL;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(SLOW_REPORT_PERIOD));
+
+    for (uint8_t i = 0; i < CMD_TRIAL_CNT; i++)
+    {
+        // land at a different point of the slow report period each trial
+        vTaskDelay((137UL * (i + 1UL)) / portTICK_PERIOD_MS);
+
+        start_us = esp_timer_get_time();
+        TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+        cmd_us = esp_timer_get_time() - start_us;
+        cmd_max_us = (cmd_us > cmd_max_us) ? cmd_us : cmd_max_us;
+
+        TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.disable());
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    sprintf(msg_buff, "Wake pin: %s, max command latency: %lldus",
+            (CONFIG_ESP32_BNO08X_GPIO_WAKE >= 0) ? "connected" : "not connected", cmd_max_us);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    // without the wake pin commands wait for the next report, only bounded by the slow report period
+    if (CONFIG_ESP32_BNO08X_GPIO_WAKE >= 0)
+        TEST_ASSERT_TRUE(cmd_max_us < WAKE_CMD_LATENCY_MAX_US);
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("HINT Timeout Recovery", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "HINT Timeout Recovery";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 10;
+    static const constexpr int64_t RECOVERY_TIMEOUT_US = 20000000LL; // 20s, two full retry ladders and a reset
+    constexpr uint32_t REPORT_PERIOD = 10000UL;                      // 10ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_hint_recovery_stats_t stats;
+    bno08x_meta_data_t meta_data;
+    uint32_t reset_cnt = 0UL;
+    int64_t start_us = 0LL;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // idle hub, a transaction times out while no HINT is due so the timeouts must not escalate to resets
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+    imu->clear_hint_recovery_stats();
+
+    BNO08xTestHelper::print_test_msg(TEST_TAG, "Holding IMU in reset with no reports enabled.");
+    BNO08xTestHelper::hold_test_imu_reset(true);
+    TEST_ASSERT_EQUAL(false, imu->rpt.accelerometer.get_meta_data(meta_data));
+
+    // every failed wait ran the full retry ladder before being judged idle
+    stats = imu->get_hint_recovery_stats();
+    TEST_ASSERT_TRUE(stats.idle_timeouts != 0UL);
+    TEST_ASSERT_EQUAL(stats.idle_timeouts * (CONFIG_ESP32_BNO08X_HINT_TIMEOUT_RETRIES + 1UL), stats.timeouts);
+    TEST_ASSERT_EQUAL(stats.idle_timeouts * CONFIG_ESP32_BNO08X_HINT_TIMEOUT_RETRIES, stats.retries);
+    TEST_ASSERT_EQUAL(0UL, stats.recovered);
+    TEST_ASSERT_EQUAL(0UL, stats.soft_resets);
+    TEST_ASSERT_EQUAL(0UL, stats.hard_resets);
+
+    // the released IMU boots and is recovered like after any other reset
+    reset_cnt = imu->get_reset_count();
+    BNO08xTestHelper::hold_test_imu_reset(false);
+    start_us = esp_timer_get_time();
+    while ((imu->get_reset_count() == reset_cnt) && ((esp_timer_get_time() - start_us) < RECOVERY_TIMEOUT_US))
+        vTaskDelay(10UL / portTICK_PERIOD_MS);
+    TEST_ASSERT_TRUE(imu->get_reset_count() > reset_cnt);
+
+    // stuck hub, a continuous report is enabled so the stalled HINT must escalate to a reset
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->data_available());
+    imu->clear_hint_recovery_stats();
+    reset_cnt = imu->get_reset_count();
+
+    BNO08xTestHelper::print_test_msg(TEST_TAG, "Holding IMU in reset with accelerometer enabled.");
+    BNO08xTestHelper::hold_test_imu_reset(true);
+    imu->rpt.accelerometer.get_meta_data(meta_data); // fails or succeeds after the reset, only used to wait for HINT
+
+    // with WAKE connected a soft reset is attempted first, it cannot reach a hub held in reset and escalates
+    start_us = esp_timer_get_time();
+    while ((imu->get_hint_recovery_stats().hard_resets == 0UL) && ((esp_timer_get_time() - start_us) < RECOVERY_TIMEOUT_US))
+        vTaskDelay(10UL / portTICK_PERIOD_MS);
+
+    stats = imu->get_hint_recovery_stats();
+
+    sprintf(msg_buff,
+            "timeouts: %" PRIu32 " retries: %" PRIu32 " recovered: %" PRIu32 " idle: %" PRIu32 " soft resets: %" PRIu32
+            " hard resets: %" PRIu32,
+            stats.timeouts, stats.retries, stats.recovered, stats.idle_timeouts, stats.soft_resets, stats.hard_resets);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    TEST_ASSERT_EQUAL(1UL, stats.hard_resets);
+    TEST_ASSERT_EQUAL(0UL, stats.soft_resets);
+    TEST_ASSERT_EQUAL(0UL, stats.idle_timeouts);
+    TEST_ASSERT_TRUE(stats.timeouts >= (CONFIG_ESP32_BNO08X_HINT_TIMEOUT_RETRIES + 1UL));
+    TEST_ASSERT_TRUE(stats.retries >= CONFIG_ESP32_BNO08X_HINT_TIMEOUT_RETRIES);
+
+    // the hard reset released RST, data resumes once the report is restored
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+    }
+
+    TEST_ASSERT_TRUE(imu->get_reset_count() > reset_cnt);
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    imu->clear_hint_recovery_stats();
+    stats = imu->get_hint_recovery_stats();
+    TEST_ASSERT_EQUAL(0UL, stats.timeouts);
+    TEST_ASSERT_EQUAL(0UL, stats.retries);
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Suspend & Resume", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Suspend & Resume";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 10;
+    constexpr uint32_t REPORT_PERIOD = 10000UL; // 10ms
+    constexpr uint32_t SUSPENDED_PERIOD_MS = 500UL;
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    int64_t resume_start_us = 0;
+    int64_t resume_us = 0;
+    BNO08xSubscriber* subscriber = nullptr;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(REPORT_PERIOD));
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->suspend());
+    TEST_ASSERT_EQUAL(false, imu->suspend());
+
+    // resets would wake the hub and re-enable HINT while suspended
+    TEST_ASSERT_EQUAL(false, imu->hard_reset());
+    TEST_ASSERT_EQUAL(false, imu->soft_reset());
+
+    subscriber = imu->create_subscriber();
+    TEST_ASSERT_NOT_EQUAL(nullptr, subscriber);
+    TEST_ASSERT_EQUAL(true, subscriber->subscribe(imu->rpt.accelerometer));
+
+    // drain reports received before the hub went to sleep, then no new ones must arrive
+    while (subscriber->data_available(50UL))
+        subscriber->has_new_data(imu->rpt.accelerometer);
+
+    TEST_ASSERT_EQUAL(false, subscriber->data_available(SUSPENDED_PERIOD_MS));
+    TEST_ASSERT_EQUAL(true, imu->destroy_subscriber(subscriber));
+
+    resume_start_us = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(true, imu->resume());
+    resume_us = esp_timer_get_time() - resume_start_us;
+    TEST_ASSERT_EQUAL(false, imu->resume());
+
+    sprintf(msg_buff, "resume() took %lldus", resume_us);
+    BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+    // reports enabled before suspending resume without being re-enabled
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        TEST_ASSERT_EQUAL(true, imu->data_available());
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
+TEST_CASE("Get Next Sample", "[FeatureTests]")
+{
+    const constexpr char* TEST_TAG = "Get Next Sample";
+    static const constexpr uint8_t RX_REPORT_TRIAL_CNT = 10;
+    constexpr uint32_t REPORT_PERIOD = 50000UL;         // 50ms
+    constexpr uint32_t UNRELATED_REPORT_PERIOD = 5000UL; // 5ms
+
+    BNO08x* imu = nullptr;
+    char msg_buff[200] = {};
+    bno08x_history_entry_t<bno08x_gyro_t> sample;
+    uint32_t prev_seq = 0UL;
+    uint64_t prev_timestamp_us = 0ULL;
+    int64_t wait_start_us = 0;
+    int64_t wait_us = 0;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    imu = BNO08xTestHelper::get_test_imu();
+
+    // unrelated traffic at 10x the rate, must not end get_next() early
+    TEST_ASSERT_EQUAL(true, imu->rpt.accelerometer.enable(UNRELATED_REPORT_PERIOD));
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.enable(REPORT_PERIOD));
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.get_next(sample));
+    prev_seq = sample.data.seq;
+    prev_timestamp_us = sample.timestamp_us;
+
+    for (int i = 0; i < RX_REPORT_TRIAL_CNT; i++)
+    {
+        wait_start_us = esp_timer_get_time();
+        TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.get_next(sample));
+        wait_us = esp_timer_get_time() - wait_start_us;
+
+        sprintf(msg_buff, "Rx Trial %d Success: seq: %" PRIu32 " timestamp: %lluus waited: %lldus", (i + 1),
+                sample.data.seq, sample.timestamp_us, wait_us);
+        BNO08xTestHelper::print_test_msg(TEST_TAG, msg_buff);
+
+        // every call returns a sample newer than the previous one
+        TEST_ASSERT_TRUE(sample.data.seq != prev_seq);
+        TEST_ASSERT_TRUE(sample.timestamp_us > prev_timestamp_us);
+        TEST_ASSERT_TRUE(wait_us > static_cast<int64_t>(UNRELATED_REPORT_PERIOD));
+
+        prev_seq = sample.data.seq;
+        prev_timestamp_us = sample.timestamp_us;
+    }
+
+    TEST_ASSERT_EQUAL(true, imu->rpt.cal_gyro.disable());
+
+    // accelerometer keeps streaming, get_next() on the disabled report times out
+    TEST_ASSERT_EQUAL(false, imu->rpt.cal_gyro.get_next(sample, 3UL * REPORT_PERIOD / 1000UL));
+
+    TEST_ASSERT_EQUAL(true, imu->disable_all_reports());
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+
 TEST_CASE("Enable Dynamic Calibration", "[FeatureTests]")
 {
     const constexpr char* TEST_TAG = "Enable Dynamic Calibration";
@@ -189,4 +189,34 @@ TEST_CASE("Init and Deinit", "[InitDenit]")
     BNO08xTestHelper::destroy_test_imu();
 
     BNO08xTestHelper::print_test_end_banner(TEST_TAG);
-}
\ No newline at end of file
+}
+#ifdef CONFIG_ESP32_BNO08X_STATIC_ALLOCATION
+TEST_CASE("Static Allocation Init and Deinit", "[InitDenit]")
+{
+    const constexpr char* TEST_TAG = "Static Allocation Init and Deinit";
+    BNO08x* imu = nullptr;
+
+    BNO08xTestHelper::print_test_start_banner(TEST_TAG);
+
+    // the whole driver lives within the object, so the published footprint is exactly its size
+    TEST_ASSERT_EQUAL(sizeof(BNO08x), BNO08X_RAM_FOOTPRINT);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        BNO08xTestHelper::print_test_msg(TEST_TAG, "Initializing statically allocated BNO08x Driver Object.");
+        BNO08xTestHelper::create_test_imu();
+        imu = BNO08xTestHelper::get_test_imu();
+        TEST_ASSERT_EQUAL(true, imu->initialize());
+
+        // relaunching tasks reuses the kill semaphore already living in its static buffer
+        BNO08xTestHelper::print_test_msg(TEST_TAG, "Relaunching tasks.");
+        TEST_ASSERT_EQUAL(ESP_OK, BNO08xTestHelper::call_deinit_tasks());
+        TEST_ASSERT_EQUAL(ESP_OK, BNO08xTestHelper::call_init_tasks());
+
+        BNO08xTestHelper::print_test_msg(TEST_TAG, "Success, deinitializing BNO08x Driver Object.");
+        BNO08xTestHelper::destroy_test_imu();
+    }
+
+    BNO08xTestHelper::print_test_end_banner(TEST_TAG);
+}
+#endif